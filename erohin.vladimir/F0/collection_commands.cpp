@@ -1,6 +1,7 @@
 #include "collection_commands.hpp"
 #include <iostream>
 #include <fstream>
+#include <functional>
 #include <limits>
 #include "list.hpp"
 #include "string_format.hpp"
@@ -208,6 +209,7 @@ void erohin::uniteCommand(collection & dict_context, std::istream & input, std::
 
 namespace erohin
 {
+  size_t getMinNumber(size_t lhs, size_t rhs);
   void makeIntersection(Dictionary & dict, const dict_pair & source);
 }
 
@@ -334,37 +336,15 @@ void erohin::makeDifference(Dictionary & dict, const dict_pair & source)
 
 void erohin::makeUnion(Dictionary & dict, const dict_pair & source)
 {
-  auto begin = source.first.records.cbegin();
-  auto end = source.first.records.cend();
-  while (begin != end)
-  {
-    dict.records[begin->first] += begin->second;
-    ++begin;
-  }
-  begin = source.second.records.cbegin();
-  end = source.second.records.cend();
-  while (begin != end)
-  {
-    auto iter_pair = dict.records.insert(*begin);
-    if (!iter_pair.second)
-    {
-      dict.records[begin->first] += begin->second;
-    }
-    ++begin;
-  }
+  dict.records = source.first.records.unite(source.second.records, std::plus< size_t >());
+}
+
+size_t erohin::getMinNumber(size_t lhs, size_t rhs)
+{
+  return std::min(lhs, rhs);
 }
 
 void erohin::makeIntersection(Dictionary & dict, const dict_pair & source)
 {
-  auto begin = source.first.records.cbegin();
-  auto end = source.first.records.cend();
-  while (begin != end)
-  {
-    auto found_iter = source.second.records.find(begin->first);
-    if (found_iter != source.second.records.cend())
-    {
-      dict.records.insert(std::make_pair(begin->first, std::min(begin->second, found_iter->second)));
-    }
-    ++begin;
-  }
+  dict.records = source.first.records.intersect(source.second.records, getMinNumber);
 }
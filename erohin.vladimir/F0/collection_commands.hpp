@@ -1,6 +1,7 @@
 #ifndef COLLECTION_COMMANDS_HPP
 #define COLLECTION_COMMANDS_HPP
 
+#include <functional>
 #include <iostream>
 #include <string>
 #include "red_black_tree.hpp"
@@ -9,7 +10,7 @@
 
 namespace erohin
 {
-  using texts_source = RedBlackTree< std::string, std::string >;
+  using texts_source = RedBlackTree< std::string, std::string, std::less<> >;
 
   void addTextCommand(texts_source & text_context, std::istream & input, std::ostream &);
   void removeTextCommand(texts_source & text_context, std::istream & input, std::ostream &);
@@ -33,8 +34,8 @@ namespace erohin
       return std::get< size_t >(pair);
     }
 
-    template< class T1, class T2 >
-    size_t countTotalNumber(const RedBlackTree< T1, T2 > & dict)
+    template< class T1, class T2, class Compare >
+    size_t countTotalNumber(const RedBlackTree< T1, T2, Compare > & dict)
     {
       size_t total_number = 0;
       auto begin = dict.cbegin();
@@ -1,6 +1,7 @@
 #ifndef DICTIONARY_HPP
 #define DICTIONARY_HPP
 
+#include <functional>
 #include <iosfwd>
 #include <string>
 #include "red_black_tree.hpp"
@@ -9,7 +10,7 @@ namespace erohin
 {
   struct Dictionary
   {
-    RedBlackTree< std::string, size_t > records;
+    RedBlackTree< std::string, size_t, std::less<> > records;
   };
 
   std::istream & operator>>(std::istream & input, Dictionary & dict);
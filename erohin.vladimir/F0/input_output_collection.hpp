@@ -1,6 +1,7 @@
 #ifndef INPUT_OUTPUT_COLLECTION_HPP
 #define INPUT_OUTPUT_COLLECTION_HPP
 
+#include <functional>
 #include <string>
 #include <iosfwd>
 #include "red_black_tree.hpp"
@@ -8,7 +9,7 @@
 
 namespace erohin
 {
-  using collection = RedBlackTree< std::string, Dictionary >;
+  using collection = RedBlackTree< std::string, Dictionary, std::less<> >;
 
   void inputCollection(collection & dict_context, std::istream & input);
   void outputCollection(const collection & dict_context, std::ostream & output);
@@ -27,14 +27,14 @@ int main(int argc, char ** argv)
     std::string format_arg(argv[1]);
     if (format_arg.substr(0, 12) == "--numformat=")
     {
-      RedBlackTree< std::string, numformat_t > format;
+      RedBlackTree< std::string, numformat_t, std::less<> > format;
       format["NUMBER"] = NUMBER;
       format["PROPORTION"] = PROPORTION;
       format["FRACTIONAL"] = FRACTIONAL;
       format["PERCENTAGE"] = PERCENTAGE;
       try
       {
-        used_numformat = format.at(format_arg.substr(12));
+        used_numformat = format.at(format_arg.c_str() + 12);
       }
       catch (const std::out_of_range &)
       {
@@ -59,7 +59,7 @@ int main(int argc, char ** argv)
   file.close();
   texts_source text_context;
   using command_func = std::function< void(std::istream &, std::ostream &) >;
-  RedBlackTree< std::string, command_func > command;
+  RedBlackTree< std::string, command_func, std::less<> > command;
   {
     using namespace std::placeholders;
     command["addtext"] = std::bind(addTextCommand, std::ref(text_context), _1, _2);
@@ -0,0 +1,68 @@
+#ifndef BENCHMARK_COMMAND_HPP
+#define BENCHMARK_COMMAND_HPP
+
+#include <iostream>
+#include <functional>
+#include <limits>
+#include <list>
+#include <deque>
+#include <vector>
+#include "dynamic_array.hpp"
+#include "list.hpp"
+#include "sort_benchmark.hpp"
+#include "sort_functions.hpp"
+
+namespace erohin
+{
+  template< class T >
+  void doBenchmarkCommand(std::ostream & output, const char * type_name, const std::vector< size_t > & sizes)
+  {
+    constexpr size_t quadratic_limit = 10000;
+    constexpr size_t no_limit = std::numeric_limits< size_t >::max();
+    auto quicksort = [](auto & seq, auto cmp)
+    {
+      doQuicksort(seq.begin(), seq.end(), cmp);
+    };
+    auto timsort = [](auto & seq, auto cmp)
+    {
+      doTimsort(seq.begin(), seq.size(), cmp);
+    };
+    auto std_sort = [](auto & seq, auto cmp)
+    {
+      std::sort(seq.begin(), seq.end(), cmp);
+    };
+    auto std_stable_sort = [](auto & seq, auto cmp)
+    {
+      std::stable_sort(seq.begin(), seq.end(), cmp);
+    };
+    auto member_sort = [](auto & seq, auto cmp)
+    {
+      seq.sort(cmp);
+    };
+    SortBenchmark< T, std::less< T > > benchmark(type_name);
+    benchmark.template add< List >("List", "doQuicksort", quicksort, quadratic_limit);
+    benchmark.template add< List >("List", "List::sort", member_sort, quadratic_limit);
+    benchmark.template add< DynamicArray >("DynamicArray", "doQuicksort", quicksort, quadratic_limit);
+    benchmark.template add< std::list >("std::list", "doQuicksort", quicksort, quadratic_limit);
+    benchmark.template add< std::list >("std::list", "std::list::sort", member_sort, no_limit);
+    benchmark.template add< std::deque >("std::deque", "doQuicksort", quicksort, quadratic_limit);
+    benchmark.template add< std::deque >("std::deque", "doTimsort", timsort, no_limit);
+    benchmark.template add< std::deque >("std::deque", "std::sort", std_sort, no_limit);
+    benchmark.template add< std::deque >("std::deque", "std::stable_sort", std_stable_sort, no_limit);
+    benchmark.run(output, sizes);
+  }
+
+  inline void doBenchmarkCommand(std::ostream & output, size_t max_size)
+  {
+    std::vector< size_t > sizes;
+    for (size_t size = 100; size <= max_size; size *= 10)
+    {
+      sizes.push_back(size);
+    }
+    output << "type,container,sort,distribution,size,ns_per_element,comparisons,moves,peak_extra_bytes\n";
+    doBenchmarkCommand< int >(output, "int", sizes);
+    doBenchmarkCommand< float >(output, "float", sizes);
+  }
+}
+
+#endif
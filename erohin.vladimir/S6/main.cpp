@@ -5,12 +5,28 @@
 #include <cstdlib>
 #include "red_black_tree.hpp"
 #include "sort_command.hpp"
+#include "benchmark_command.hpp"
 
 int main(int argc, char ** argv)
 {
   std::srand(std::time(0));
   using namespace erohin;
-  if (argc != 4)
+  if (argc == 3 && std::string(argv[1]) == "benchmark")
+  {
+    try
+    {
+      size_t max_size = std::stoull(argv[2]);
+      std::cout << std::setprecision(1) << std::fixed;
+      doBenchmarkCommand(std::cout, max_size);
+    }
+    catch (const std::exception & e)
+    {
+      std::cerr << e.what() << "\n";
+      return 2;
+    }
+    return 0;
+  }
+  if (argc != 4 && argc != 5)
   {
     std::cerr << "Wrong CLA's number\n";
     return 1;
@@ -22,14 +38,19 @@ int main(int argc, char ** argv)
     {
       throw std::invalid_argument("Invalid sequence size");
     }
+    size_t thread_count = (argc == 5) ? std::stoull(argv[4]) : 0;
+    if (argc == 5 && thread_count == 0)
+    {
+      throw std::invalid_argument("Invalid thread count");
+    }
     using sort_func_cmd = std::function< void(std::ostream &) >;
     RedBlackTree< std::pair< std::string, std::string >, sort_func_cmd > sort_case;
     {
       using namespace std::placeholders;
-      sort_case[{ "ascending", "ints" }] = std::bind(doSortCommand< int, std::less< int > >, _1, size);
-      sort_case[{ "descending", "ints" }] = std::bind(doSortCommand< int, std::greater< int > >, _1, size);
-      sort_case[{ "ascending", "floats" }] = std::bind(doSortCommand< float, std::less< float > >, _1, size);
-      sort_case[{ "descending", "floats" }] = std::bind(doSortCommand< float, std::greater< float > >, _1, size);
+      sort_case[{ "ascending", "ints" }] = std::bind(doSortCommand< int, std::less< int > >, _1, size, thread_count);
+      sort_case[{ "descending", "ints" }] = std::bind(doSortCommand< int, std::greater< int > >, _1, size, thread_count);
+      sort_case[{ "ascending", "floats" }] = std::bind(doSortCommand< float, std::less< float > >, _1, size, thread_count);
+      sort_case[{ "descending", "floats" }] = std::bind(doSortCommand< float, std::greater< float > >, _1, size, thread_count);
     }
     std::cout << std::setprecision(1) << std::fixed;
     sort_case.at({ argv[1], argv[2] })(std::cout);
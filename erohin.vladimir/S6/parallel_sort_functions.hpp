@@ -0,0 +1,163 @@
+#ifndef PARALLEL_SORT_FUNCTIONS_HPP
+#define PARALLEL_SORT_FUNCTIONS_HPP
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+#include "thread_pool.hpp"
+#include "sort_functions.hpp"
+
+namespace erohin
+{
+  namespace detail
+  {
+    constexpr size_t parallel_cutoff = 1 << 15;
+
+    template< class T, class Compare >
+    const T & getMedian(const T & first, const T & second, const T & third, Compare cmp)
+    {
+      if (cmp(first, second))
+      {
+        return (cmp(second, third)) ? second : ((cmp(first, third)) ? third : first);
+      }
+      return (cmp(first, third)) ? first : ((cmp(second, third)) ? third : second);
+    }
+
+    template< class RandomAccessIt, class Compare >
+    void doParallelQuicksort(RandomAccessIt begin, size_t size, Compare cmp, TaskGroup & group, size_t depth_limit)
+    {
+      using T = typename std::iterator_traits< RandomAccessIt >::value_type;
+      while (size > parallel_cutoff && depth_limit > 0)
+      {
+        --depth_limit;
+        T pivot = getMedian(begin[0], begin[size / 2], begin[size - 1], cmp);
+        auto middle_begin = std::partition(begin, begin + size, [&](const T & value)
+        {
+          return cmp(value, pivot);
+        });
+        auto middle_end = std::partition(middle_begin, begin + size, [&](const T & value)
+        {
+          return !cmp(pivot, value);
+        });
+        size_t left_size = middle_begin - begin;
+        group.run([=, &group]()
+        {
+          doParallelQuicksort(begin, left_size, cmp, group, depth_limit);
+        });
+        size -= middle_end - begin;
+        begin = middle_end;
+      }
+      doTimsort(begin, size, cmp);
+    }
+
+    template< class InputIt, class OutputIt, class Compare >
+    void doParallelMerge(InputIt first, size_t first_size, InputIt second, size_t second_size, OutputIt out, Compare cmp, TaskGroup & group, size_t grain)
+    {
+      while (first_size + second_size > grain)
+      {
+        size_t first_part = first_size / 2;
+        size_t second_part = second_size / 2;
+        if (first_size >= second_size)
+        {
+          second_part = std::lower_bound(second, second + second_size, first[first_part], cmp) - second;
+        }
+        else
+        {
+          first_part = std::upper_bound(first, first + first_size, second[second_part], cmp) - first;
+        }
+        group.run([=, &group]()
+        {
+          doParallelMerge(first, first_part, second, second_part, out, cmp, group, grain);
+        });
+        out += first_part + second_part;
+        first += first_part;
+        first_size -= first_part;
+        second += second_part;
+        second_size -= second_part;
+      }
+      auto first_end = first + first_size;
+      auto second_end = second + second_size;
+      std::merge(std::make_move_iterator(first), std::make_move_iterator(first_end), std::make_move_iterator(second), std::make_move_iterator(second_end), out, cmp);
+    }
+
+    template< class InputIt, class OutputIt, class Compare >
+    std::vector< size_t > doParallelMergeRound(InputIt src, OutputIt dest, const std::vector< size_t > & bounds, Compare cmp, ThreadPool & pool, size_t grain)
+    {
+      std::vector< size_t > merged_bounds{ 0 };
+      TaskGroup group(pool);
+      for (size_t i = 0; i + 1 < bounds.size(); i += 2)
+      {
+        size_t middle = bounds[i + 1];
+        size_t end = (i + 2 < bounds.size()) ? bounds[i + 2] : middle;
+        doParallelMerge(src + bounds[i], middle - bounds[i], src + middle, end - middle, dest + bounds[i], cmp, group, grain);
+        merged_bounds.push_back(end);
+      }
+      group.wait();
+      return merged_bounds;
+    }
+  }
+
+  template< class RandomAccessIt, class Compare >
+  void doParallelQuicksort(RandomAccessIt begin, size_t size, Compare cmp, ThreadPool & pool)
+  {
+    size_t depth_limit = 0;
+    for (size_t n = size; n > 1; n /= 2)
+    {
+      depth_limit += 2;
+    }
+    TaskGroup group(pool);
+    detail::doParallelQuicksort(begin, size, cmp, group, depth_limit);
+    group.wait();
+  }
+
+  template< class RandomAccessIt, class Compare >
+  void doParallelMergesort(RandomAccessIt begin, size_t size, Compare cmp, ThreadPool & pool)
+  {
+    size_t parts = std::min(pool.size(), size / detail::parallel_cutoff);
+    if (parts <= 1)
+    {
+      doTimsort(begin, size, cmp);
+      return;
+    }
+    std::vector< size_t > bounds;
+    {
+      TaskGroup group(pool);
+      for (size_t i = 0; i < parts; ++i)
+      {
+        size_t from = size * i / parts;
+        size_t to = size * (i + 1) / parts;
+        bounds.push_back(from);
+        group.run([=]()
+        {
+          doTimsort(begin + from, to - from, cmp);
+        });
+      }
+      bounds.push_back(size);
+      group.wait();
+    }
+    using T = typename std::iterator_traits< RandomAccessIt >::value_type;
+    std::vector< T > buffer(size);
+    size_t grain = std::max(detail::parallel_cutoff, size / (4 * pool.size()));
+    bool is_in_buffer = false;
+    while (bounds.size() > 2)
+    {
+      if (is_in_buffer)
+      {
+        bounds = detail::doParallelMergeRound(buffer.begin(), begin, bounds, cmp, pool, grain);
+      }
+      else
+      {
+        bounds = detail::doParallelMergeRound(begin, buffer.begin(), bounds, cmp, pool, grain);
+      }
+      is_in_buffer = !is_in_buffer;
+    }
+    if (is_in_buffer)
+    {
+      TaskGroup group(pool);
+      detail::doParallelMerge(buffer.begin(), size, buffer.end(), 0, begin, cmp, group, grain);
+      group.wait();
+    }
+  }
+}
+
+#endif
@@ -9,11 +9,13 @@
 #include "list.hpp"
 #include "sequence_operations.hpp"
 #include "sort_functions.hpp"
+#include "parallel_sort_functions.hpp"
+#include "thread_pool.hpp"
 
 namespace erohin
 {
   template< class T, class Compare >
-  void doSortCommand(std::ostream & output, size_t size)
+  void doSortCommand(std::ostream & output, size_t size, size_t thread_count)
   {
     Compare cmp;
     DynamicArray< T > random_seq(size);
@@ -27,8 +29,17 @@ namespace erohin
     doQuicksort(first_forward_list.begin(), first_forward_list.end(), cmp);
     doQuicksort(first_bi_list.begin(), first_bi_list.end(), cmp);
     second_bi_list.sort(cmp);
-    doQuicksort(first_deque.begin(), first_deque.end(), cmp);
-    doTimsort(second_deque.begin(), size, cmp);
+    if (thread_count)
+    {
+      ThreadPool pool(thread_count);
+      doParallelQuicksort(first_deque.begin(), size, cmp, pool);
+      doParallelMergesort(second_deque.begin(), size, cmp, pool);
+    }
+    else
+    {
+      doQuicksort(first_deque.begin(), first_deque.end(), cmp);
+      doTimsort(second_deque.begin(), size, cmp);
+    }
     std::sort(third_deque.begin(), third_deque.end(), cmp);
     printSequence(output, random_seq.cbegin(), random_seq.cend());
     printSequence(output << "\n", first_forward_list.cbegin(), first_forward_list.cend());
@@ -46,80 +46,214 @@ namespace erohin
 
   namespace detail
   {
+    constexpr size_t min_gallop = 7;
+    constexpr size_t max_run_count = 85;
+
+    template< class RandomAccessIt, class Compare >
+    void doInsertsort(RandomAccessIt begin, size_t sorted, size_t size, Compare cmp)
+    {
+      using T = typename std::iterator_traits< RandomAccessIt >::value_type;
+      for (size_t i = std::max< size_t >(sorted, 1); i < size; ++i)
+      {
+        auto cur_iter = begin + i;
+        auto place = std::upper_bound(begin, cur_iter, *cur_iter, cmp);
+        if (place != cur_iter)
+        {
+          T temp(std::move(*cur_iter));
+          std::move_backward(place, cur_iter, std::next(cur_iter));
+          *place = std::move(temp);
+        }
+      }
+    }
+
     template< class RandomAccessIt, class Compare >
-    void doInsertsort(RandomAccessIt begin, size_t size, Compare cmp)
+    size_t countRun(RandomAccessIt begin, size_t size, Compare cmp)
     {
       if (size <= 1)
       {
-        return;
+        return size;
       }
-      size_t i = 1;
-      auto cur_iter = std::next(begin);
-      while (i < size)
+      size_t run = 2;
+      if (cmp(begin[1], begin[0]))
+      {
+        while (run < size && cmp(begin[run], begin[run - 1]))
+        {
+          ++run;
+        }
+        std::reverse(begin, begin + run);
+      }
+      else
+      {
+        while (run < size && !cmp(begin[run], begin[run - 1]))
+        {
+          ++run;
+        }
+      }
+      return run;
+    }
+
+    template< class RandomAccessIt, class Predicate >
+    size_t gallop(RandomAccessIt begin, size_t size, Predicate pred)
+    {
+      size_t bound = 1;
+      while (bound <= size && pred(begin[bound - 1]))
+      {
+        bound *= 2;
+      }
+      size_t low = bound / 2;
+      size_t high = std::min(bound - 1, size);
+      while (low < high)
+      {
+        size_t middle = low + (high - low) / 2;
+        if (pred(begin[middle]))
+        {
+          low = middle + 1;
+        }
+        else
+        {
+          high = middle;
+        }
+      }
+      return low;
+    }
+
+    template< class RandomAccessIt, class T, class Compare >
+    void doMergeLow(RandomAccessIt begin, size_t left_size, size_t right_size, T * buffer, Compare cmp, size_t & gallop_limit)
+    {
+      T * left = buffer;
+      T * left_end = std::move(begin, begin + left_size, buffer);
+      RandomAccessIt right = begin + left_size;
+      RandomAccessIt right_end = right + right_size;
+      RandomAccessIt dest = begin;
+      while (left != left_end && right != right_end)
       {
-        auto temp_iter = cur_iter;
-        auto start = std::prev(cur_iter);
-        while (temp_iter != begin)
+        size_t left_count = 0;
+        size_t right_count = 0;
+        while (left != left_end && right != right_end && std::max(left_count, right_count) < gallop_limit)
         {
-          if (cmp(*temp_iter, *start))
+          if (cmp(*right, *left))
           {
-            std::iter_swap(temp_iter, start);
-            --temp_iter;
+            *(dest++) = std::move(*(right++));
+            ++right_count;
+            left_count = 0;
           }
           else
+          {
+            *(dest++) = std::move(*(left++));
+            ++left_count;
+            right_count = 0;
+          }
+        }
+        while (left != left_end && right != right_end)
+        {
+          gallop_limit -= (gallop_limit > 1);
+          left_count = gallop(left, left_end - left, [&](const T & value)
+          {
+            return !cmp(*right, value);
+          });
+          dest = std::move(left, left + left_count, dest);
+          left += left_count;
+          if (left == left_end)
+          {
+            break;
+          }
+          right_count = gallop(right, right_end - right, [&](const T & value)
+          {
+            return cmp(value, *left);
+          });
+          dest = std::move(right, right + right_count, dest);
+          right += right_count;
+          if (left_count < min_gallop && right_count < min_gallop)
           {
             break;
           }
-          start--;
         }
-        ++cur_iter;
-        ++i;
+        ++gallop_limit;
       }
+      std::move(left, left_end, dest);
     }
 
-    template< class RandomAccessIt, class Compare >
-    void doMergesort(RandomAccessIt begin, size_t size, Compare cmp)
+    template< class RandomAccessIt, class T, class Compare >
+    void doMergeRuns(RandomAccessIt begin, size_t left_size, size_t right_size, T * buffer, Compare cmp, size_t & gallop_limit)
+    {
+      RandomAccessIt right = begin + left_size;
+      size_t skipped = gallop(begin, left_size, [&](const T & value)
+      {
+        return !cmp(*right, value);
+      });
+      begin += skipped;
+      left_size -= skipped;
+      if (!left_size)
+      {
+        return;
+      }
+      const T & left_last = *std::prev(right);
+      right_size -= gallop(std::reverse_iterator< RandomAccessIt >(right + right_size), right_size, [&](const T & value)
+      {
+        return !cmp(value, left_last);
+      });
+      if (!right_size)
+      {
+        return;
+      }
+      if (left_size <= right_size)
+      {
+        doMergeLow(begin, left_size, right_size, buffer, cmp, gallop_limit);
+      }
+      else
+      {
+        auto reversed_cmp = [&](const T & lhs, const T & rhs)
+        {
+          return cmp(rhs, lhs);
+        };
+        doMergeLow(std::reverse_iterator< RandomAccessIt >(right + right_size), right_size, left_size, buffer, reversed_cmp, gallop_limit);
+      }
+    }
+
+    template< class RandomAccessIt, class T, class Compare >
+    void doMergesort(RandomAccessIt begin, size_t size, T * buffer, Compare cmp, size_t & gallop_limit)
     {
       if (size <= 1)
       {
         return;
       }
       size_t left_size = size / 2;
-      size_t right_size = size - size / 2;
-      doMergesort(begin, left_size, cmp);
-      doMergesort(begin + left_size, right_size, cmp);
-      size_t l_size = left_size;
-      size_t r_size = right_size;
-      using T = typename RandomAccessIt::value_type;
-      T * temp_arr = new T[size]{ *begin };
+      doMergesort(begin, left_size, buffer, cmp, gallop_limit);
+      doMergesort(begin + left_size, size - left_size, buffer, cmp, gallop_limit);
+      doMergeRuns(begin, left_size, size - left_size, buffer, cmp, gallop_limit);
+    }
+
+    template< class RandomAccessIt, class Compare >
+    void doMergesort(RandomAccessIt begin, size_t size, Compare cmp)
+    {
+      using T = typename std::iterator_traits< RandomAccessIt >::value_type;
+      T * buffer = new T[size / 2 + 1];
       try
       {
-        while ((l_size > 0) || (r_size > 0))
-        {
-          size_t cur_index = size - l_size - r_size;
-          if (r_size == 0 || (l_size > 0 && cmp(begin[left_size - l_size], begin[left_size + right_size - r_size])))
-          {
-            temp_arr[cur_index] = std::move(begin[left_size - l_size]);
-            --l_size;
-          }
-          else
-          {
-            temp_arr[cur_index] = std::move(begin[left_size + right_size - r_size]);
-            --r_size;
-          }
-        }
-        for (size_t i = 0; i < size; ++i)
-        {
-          begin[i] = std::move(temp_arr[i]);
-        }
-        delete[] temp_arr;
+        size_t gallop_limit = min_gallop;
+        doMergesort(begin, size, buffer, cmp, gallop_limit);
       }
       catch (...)
       {
-        delete[] temp_arr;
+        delete[] buffer;
         throw;
       }
+      delete[] buffer;
+    }
 
+    template< class RandomAccessIt, class T, class Compare >
+    void doMergeAt(RandomAccessIt begin, size_t * run_base, size_t * run_size, size_t & run_count, size_t index, T * buffer, Compare cmp, size_t & gallop_limit)
+    {
+      size_t left_size = run_size[index];
+      size_t right_size = run_size[index + 1];
+      run_size[index] = left_size + right_size;
+      if (index + 3 == run_count)
+      {
+        run_base[index + 1] = run_base[index + 2];
+        run_size[index + 1] = run_size[index + 2];
+      }
+      --run_count;
+      doMergeRuns(begin + run_base[index], left_size, right_size, buffer, cmp, gallop_limit);
     }
   }
 
@@ -138,19 +272,69 @@ namespace erohin
       n = n >> 1;
     }
     min_run = n + min_run;
-    for (size_t i = 0; i < size; i += min_run)
+    if (size <= min_run)
     {
-      detail::doInsertsort(begin + i, min_run, cmp);
+      detail::doInsertsort(begin, detail::countRun(begin, size, cmp), size, cmp);
+      return;
     }
-    size_t run = min_run;
-    while (run < size)
+    using T = typename std::iterator_traits< RandomAccessIt >::value_type;
+    T * buffer = new T[size / 2 + 1];
+    try
     {
-      for (size_t i = 0; i < size; i += (run * 2))
+      size_t run_base[detail::max_run_count] = {};
+      size_t run_size[detail::max_run_count] = {};
+      size_t run_count = 0;
+      size_t gallop_limit = detail::min_gallop;
+      size_t start = 0;
+      while (start < size)
+      {
+        size_t remaining = size - start;
+        size_t run = detail::countRun(begin + start, remaining, cmp);
+        if (run < min_run)
+        {
+          size_t forced = std::min(min_run, remaining);
+          detail::doInsertsort(begin + start, run, forced, cmp);
+          run = forced;
+        }
+        run_base[run_count] = start;
+        run_size[run_count] = run;
+        ++run_count;
+        start += run;
+        while (run_count > 1)
+        {
+          size_t i = run_count - 2;
+          bool is_broken = (i > 0 && run_size[i - 1] <= run_size[i] + run_size[i + 1]);
+          is_broken = is_broken || (i > 1 && run_size[i - 2] <= run_size[i - 1] + run_size[i]);
+          if (is_broken)
+          {
+            if (run_size[i - 1] < run_size[i + 1])
+            {
+              --i;
+            }
+          }
+          else if (run_size[i] > run_size[i + 1])
+          {
+            break;
+          }
+          detail::doMergeAt(begin, run_base, run_size, run_count, i, buffer, cmp, gallop_limit);
+        }
+      }
+      while (run_count > 1)
       {
-        detail::doMergesort(begin + i, run * 2, cmp);
+        size_t i = run_count - 2;
+        if (i > 0 && run_size[i - 1] < run_size[i + 1])
+        {
+          --i;
+        }
+        detail::doMergeAt(begin, run_base, run_size, run_count, i, buffer, cmp, gallop_limit);
       }
-      run *= 2;
     }
+    catch (...)
+    {
+      delete[] buffer;
+      throw;
+    }
+    delete[] buffer;
   }
 }
 
@@ -76,18 +76,36 @@ namespace erohin
     iterator erase(iterator first, iterator last);
     iterator erase(const_iterator first, const_iterator last);
     void swap(RedBlackTree & rhs) noexcept;
+    void merge(RedBlackTree & source);
+    template< class F >
+    RedBlackTree< Key, T, Compare > unite(const RedBlackTree & rhs, F combine) const;
+    template< class F >
+    RedBlackTree< Key, T, Compare > intersect(const RedBlackTree & rhs, F combine) const;
     size_t size() const noexcept;
     size_t count(const Key & key) const;
     iterator find(const Key & key);
     const_iterator find(const Key & key) const;
     T & at(const Key & key);
     const T & at(const Key & key) const;
+    template< class K, class C = Compare, class = typename C::is_transparent >
+    size_t count(const K & key) const;
+    template< class K, class C = Compare, class = typename C::is_transparent >
+    iterator find(const K & key);
+    template< class K, class C = Compare, class = typename C::is_transparent >
+    const_iterator find(const K & key) const;
+    template< class K, class C = Compare, class = typename C::is_transparent >
+    T & at(const K & key);
+    template< class K, class C = Compare, class = typename C::is_transparent >
+    const T & at(const K & key) const;
     iterator lower_bound(const Key & key);
     const_iterator lower_bound(const Key & key) const;
     iterator upper_bound(const Key & key);
     const_iterator upper_bound(const Key & key) const;
     std::pair< iterator, iterator > equal_range(const Key & key);
     std::pair< const_iterator, const_iterator > equal_range(const Key & key) const;
+    iterator select(size_t index);
+    const_iterator select(size_t index) const;
+    size_t rank(const Key & key) const;
     template< class F >
     F traverse_lnr(F f) const;
     template< class F >
@@ -100,16 +118,22 @@ namespace erohin
     Compare cmp_;
     char fake_[sizeof(detail::TreeNode< Key, T >)];
     detail::TreeNode< Key, T > * make_fake_node() const;
+    template< class K >
+    detail::TreeNode< Key, T > * search(const K & key) const;
     void clear_subtree(detail::TreeNode< Key, T > * subtree);
+    static void clear_chain(detail::TreeNode< Key, T > * chain);
+    static detail::TreeNode< Key, T > * make_chain(detail::TreeNode< Key, T > * subtree);
+    void build_from_chain(detail::TreeNode< Key, T > * chain, size_t count);
+    static detail::TreeNode< Key, T > * build_subtree(detail::TreeNode< Key, T > *& chain, size_t count, size_t depth, size_t red_depth);
     detail::TreeNode< Key, T > * find_to_change_erased(detail::TreeNode< Key, T > * subtree);
     detail::TreeNode< Key, T > * find_grandparent(detail::TreeNode< Key, T > * subtree);
     detail::TreeNode< Key, T > * find_uncle(detail::TreeNode< Key, T > * subtree);
-    detail::TreeNode< Key, T > * find_brother(detail::TreeNode< Key, T > * subtree);
     template< detail::color_t C >
     bool is_color(detail::TreeNode< Key, T > * node);
     template< detail::color_t C >
     void colorize(detail::TreeNode< Key, T > * node);
-    bool is_leaf(detail::TreeNode< Key, T > * node);
+    static void increase_path_size(detail::TreeNode< Key, T > * node);
+    void transplant(detail::TreeNode< Key, T > * subtree, detail::TreeNode< Key, T > * node);
     void rotate_left(detail::TreeNode< Key, T > * subtree);
     void rotate_right(detail::TreeNode< Key, T > * subtree);
     void insert_balance_case1(detail::TreeNode< Key, T > * subtree);
@@ -117,12 +141,7 @@ namespace erohin
     void insert_balance_case3(detail::TreeNode< Key, T > * subtree);
     void insert_balance_case4(detail::TreeNode< Key, T > * subtree);
     void insert_balance_case5(detail::TreeNode< Key, T > * subtree);
-    void erase_balance_case1(detail::TreeNode< Key, T > * subtree);
-    void erase_balance_case2(detail::TreeNode< Key, T > * subtree);
-    void erase_balance_case3(detail::TreeNode< Key, T > * subtree);
-    void erase_balance_case4(detail::TreeNode< Key, T > * subtree);
-    void erase_balance_case5(detail::TreeNode< Key, T > * subtree);
-    void erase_balance_case6(detail::TreeNode< Key, T > * subtree);
+    void erase_balance(detail::TreeNode< Key, T > * subtree, detail::TreeNode< Key, T > * parent);
   };
 
   template< class Key, class T, class Compare >
@@ -153,19 +172,10 @@ namespace erohin
   template< class Key, class T, class Compare >
   template< class InputIt >
   RedBlackTree< Key, T, Compare >::RedBlackTree(InputIt first, InputIt last):
-    root_(nullptr)
+    root_(nullptr),
+    size_(0)
   {
-    while (first != last)
-    {
-      try
-      {
-        insert(*(first++));
-      }
-      catch (...)
-      {
-        clear();
-      }
-    }
+    insert(first, last);
   }
 
   template< class Key, class T, class Compare >
@@ -194,6 +204,11 @@ namespace erohin
   template< class Key, class T, class Compare >
   T & RedBlackTree< Key, T, Compare >::operator[](const Key & key)
   {
+    detail::TreeNode< Key, T > * node = search(key);
+    if (node)
+    {
+      return node->data.second;
+    }
     auto iter = insert(std::make_pair(key, T())).first;
     return iter->second;
   }
@@ -420,6 +435,7 @@ namespace erohin
         delete node;
         throw;
       }
+      increase_path_size(node);
     }
     insert_balance_case1(node);
     ++size_;
@@ -466,6 +482,7 @@ namespace erohin
       delete node;
       throw;
     }
+    increase_path_size(node);
     insert_balance_case1(node);
     ++size_;
     return iterator(node);
@@ -475,6 +492,40 @@ namespace erohin
   template< class InputIt >
   void RedBlackTree< Key, T, Compare >::insert(InputIt first, InputIt last)
   {
+    if (empty())
+    {
+      detail::TreeNode< Key, T > * chain = nullptr;
+      detail::TreeNode< Key, T > ** tail = std::addressof(chain);
+      size_t count = 0;
+      try
+      {
+        while (first != last)
+        {
+          if (count && !cmp_((*tail)->data.first, (*first).first))
+          {
+            if (cmp_((*first).first, (*tail)->data.first))
+            {
+              break;
+            }
+            ++first;
+            continue;
+          }
+          if (count)
+          {
+            tail = std::addressof((*tail)->right);
+          }
+          *tail = new detail::TreeNode< Key, T >(nullptr, nullptr, nullptr, *first);
+          ++first;
+          ++count;
+        }
+      }
+      catch (...)
+      {
+        clear_chain(chain);
+        throw;
+      }
+      build_from_chain(chain, count);
+    }
     while (first != last)
     {
       insert(*(first++));
@@ -535,6 +586,7 @@ namespace erohin
       delete emplaced;
       throw;
     }
+    increase_path_size(emplaced);
     insert_balance_case1(emplaced);
     ++size_;
     return std::make_pair(iterator(emplaced), true);
@@ -581,6 +633,7 @@ namespace erohin
       delete emplaced;
       throw;
     }
+    increase_path_size(emplaced);
     insert_balance_case1(emplaced);
     ++size_;
     return std::make_pair(iterator(emplaced), true);
@@ -616,34 +669,47 @@ namespace erohin
   template< class Key, class T, class Compare >
   TreeIterator< Key, T > RedBlackTree< Key, T, Compare >::erase(iterator pos)
   {
-    detail::TreeNode< Key, T > * to_delete = pos.node_;
-    detail::TreeNode< Key, T > * found = find_to_change_erased(to_delete);
-    if (to_delete == root_ && !found)
-    {
-      clear();
-      return end();
-    }
-    else if (!found)
+    using namespace detail;
+    TreeNode< Key, T > * to_delete = pos.node_;
+    iterator result(to_delete->next());
+    TreeNode< Key, T > * child = nullptr;
+    TreeNode< Key, T > * parent = nullptr;
+    color_t erased_color = to_delete->color;
+    if (!to_delete->left || !to_delete->right)
     {
-      found = to_delete;
+      child = (to_delete->left) ? to_delete->left : to_delete->right;
+      parent = to_delete->parent;
+      transplant(to_delete, child);
     }
-    if (found->parent->left == found)
+    else
     {
-      found->parent->left = found->left;
+      TreeNode< Key, T > * heir = find_to_change_erased(to_delete);
+      erased_color = heir->color;
+      child = heir->left;
+      parent = heir;
+      if (heir->parent != to_delete)
+      {
+        parent = heir->parent;
+        transplant(heir, child);
+        heir->left = to_delete->left;
+        heir->left->parent = heir;
+      }
+      transplant(to_delete, heir);
+      heir->right = to_delete->right;
+      heir->right->parent = heir;
+      heir->color = to_delete->color;
     }
-    else if (found->parent->right == found)
+    for (TreeNode< Key, T > * node = parent; node; node = node->parent)
     {
-      found->parent->right = found->right;
+      update_size(node);
     }
-    if (found != to_delete)
+    if (erased_color == BLACK)
     {
-      std::swap(found->data, to_delete->data);
+      erase_balance(child, parent);
     }
-    erase_balance_case1(found);
-    auto iter = ++pos;
-    delete found;
+    delete to_delete;
     --size_;
-    return iter;
+    return result;
   }
 
   template< class Key, class T, class Compare >
@@ -679,71 +745,160 @@ namespace erohin
   void RedBlackTree< Key, T, Compare >::swap(RedBlackTree< Key, T, Compare > & rhs) noexcept
   {
     std::swap(root_, rhs.root_);
+    std::swap(size_, rhs.size_);
+    std::swap(cmp_, rhs.cmp_);
   }
 
   template< class Key, class T, class Compare >
-  size_t RedBlackTree< Key, T, Compare >::size() const noexcept
+  void RedBlackTree< Key, T, Compare >::merge(RedBlackTree< Key, T, Compare > & source)
   {
-    return size_;
+    if (std::addressof(source) == this || source.empty())
+    {
+      return;
+    }
+    detail::TreeNode< Key, T > * lhs = make_chain(root_);
+    detail::TreeNode< Key, T > * rhs = make_chain(source.root_);
+    detail::TreeNode< Key, T > * merged = nullptr;
+    detail::TreeNode< Key, T > ** merged_tail = std::addressof(merged);
+    detail::TreeNode< Key, T > * rest = nullptr;
+    detail::TreeNode< Key, T > ** rest_tail = std::addressof(rest);
+    size_t count = size_ + source.size_;
+    size_t rest_count = 0;
+    while (lhs && rhs)
+    {
+      if (cmp_(rhs->data.first, lhs->data.first))
+      {
+        *merged_tail = rhs;
+        rhs = rhs->right;
+      }
+      else
+      {
+        if (!cmp_(lhs->data.first, rhs->data.first))
+        {
+          *rest_tail = rhs;
+          rest_tail = std::addressof(rhs->right);
+          rhs = rhs->right;
+          ++rest_count;
+        }
+        *merged_tail = lhs;
+        lhs = lhs->right;
+      }
+      merged_tail = std::addressof((*merged_tail)->right);
+    }
+    *merged_tail = lhs ? lhs : rhs;
+    *rest_tail = nullptr;
+    build_from_chain(merged, count - rest_count);
+    source.build_from_chain(rest, rest_count);
   }
 
   template< class Key, class T, class Compare >
-  size_t RedBlackTree< Key, T, Compare >::count(const Key & key) const
-  {
-    auto citer = cbegin();
-    size_t size = 0;
-    while (citer != cend())
+  template< class F >
+  RedBlackTree< Key, T, Compare > RedBlackTree< Key, T, Compare >::unite(const RedBlackTree & rhs, F combine) const
+  {
+    RedBlackTree< Key, T, Compare > result;
+    detail::TreeNode< Key, T > * chain = nullptr;
+    detail::TreeNode< Key, T > ** tail = std::addressof(chain);
+    size_t count = 0;
+    auto lhs_iter = cbegin();
+    auto rhs_iter = rhs.cbegin();
+    try
     {
-      if (!cmp_(key, citer->first) && !cmp_(citer->first, key))
+      while (lhs_iter != cend() || rhs_iter != rhs.cend())
       {
-        ++size;
+        if (rhs_iter == rhs.cend() || (lhs_iter != cend() && cmp_(lhs_iter->first, rhs_iter->first)))
+        {
+          *tail = new detail::TreeNode< Key, T >(nullptr, nullptr, nullptr, *(lhs_iter++));
+        }
+        else if (lhs_iter == cend() || cmp_(rhs_iter->first, lhs_iter->first))
+        {
+          *tail = new detail::TreeNode< Key, T >(nullptr, nullptr, nullptr, *(rhs_iter++));
+        }
+        else
+        {
+          value_type value(lhs_iter->first, combine(lhs_iter->second, rhs_iter->second));
+          *tail = new detail::TreeNode< Key, T >(nullptr, nullptr, nullptr, std::move(value));
+          ++lhs_iter;
+          ++rhs_iter;
+        }
+        tail = std::addressof((*tail)->right);
+        ++count;
       }
     }
-    return size;
+    catch (...)
+    {
+      clear_chain(chain);
+      throw;
+    }
+    result.build_from_chain(chain, count);
+    return result;
   }
 
   template< class Key, class T, class Compare >
-  TreeIterator< Key, T > RedBlackTree< Key, T, Compare >::find(const Key & key)
-  {
-    detail::TreeNode< Key, T > * node = root_;
-    while (node)
+  template< class F >
+  RedBlackTree< Key, T, Compare > RedBlackTree< Key, T, Compare >::intersect(const RedBlackTree & rhs, F combine) const
+  {
+    RedBlackTree< Key, T, Compare > result;
+    detail::TreeNode< Key, T > * chain = nullptr;
+    detail::TreeNode< Key, T > ** tail = std::addressof(chain);
+    size_t count = 0;
+    auto lhs_iter = cbegin();
+    auto rhs_iter = rhs.cbegin();
+    try
     {
-      if (cmp_(key, node->data.first))
+      while (lhs_iter != cend() && rhs_iter != rhs.cend())
       {
-        node = node->left;
-      }
-      else if (cmp_(node->data.first, key))
-      {
-        node = node->right;
-      }
-      else
-      {
-        return iterator(node);
+        if (cmp_(lhs_iter->first, rhs_iter->first))
+        {
+          ++lhs_iter;
+        }
+        else if (cmp_(rhs_iter->first, lhs_iter->first))
+        {
+          ++rhs_iter;
+        }
+        else
+        {
+          value_type value(lhs_iter->first, combine(lhs_iter->second, rhs_iter->second));
+          *tail = new detail::TreeNode< Key, T >(nullptr, nullptr, nullptr, std::move(value));
+          tail = std::addressof((*tail)->right);
+          ++count;
+          ++lhs_iter;
+          ++rhs_iter;
+        }
       }
     }
-    return end();
+    catch (...)
+    {
+      clear_chain(chain);
+      throw;
+    }
+    result.build_from_chain(chain, count);
+    return result;
+  }
+
+  template< class Key, class T, class Compare >
+  size_t RedBlackTree< Key, T, Compare >::size() const noexcept
+  {
+    return size_;
+  }
+
+  template< class Key, class T, class Compare >
+  size_t RedBlackTree< Key, T, Compare >::count(const Key & key) const
+  {
+    return (search(key) != nullptr);
+  }
+
+  template< class Key, class T, class Compare >
+  TreeIterator< Key, T > RedBlackTree< Key, T, Compare >::find(const Key & key)
+  {
+    detail::TreeNode< Key, T > * node = search(key);
+    return node ? iterator(node) : end();
   }
 
   template< class Key, class T, class Compare >
   TreeConstIterator< Key, T > RedBlackTree< Key, T, Compare >::find(const Key & key) const
   {
-    const detail::TreeNode< Key, T > * node = root_;
-    while (node)
-    {
-      if (cmp_(key, node->data.first))
-      {
-        node = node->left;
-      }
-      else if (cmp_(node->data.first, key))
-      {
-        node = node->right;
-      }
-      else
-      {
-        return const_iterator(node);
-      }
-    }
-    return cend();
+    const detail::TreeNode< Key, T > * node = search(key);
+    return node ? const_iterator(node) : cend();
   }
 
   template< class Key, class T, class Compare >
@@ -768,6 +923,53 @@ namespace erohin
     return iter->second;
   }
 
+  template< class Key, class T, class Compare >
+  template< class K, class C, class >
+  size_t RedBlackTree< Key, T, Compare >::count(const K & key) const
+  {
+    return (search(key) != nullptr);
+  }
+
+  template< class Key, class T, class Compare >
+  template< class K, class C, class >
+  TreeIterator< Key, T > RedBlackTree< Key, T, Compare >::find(const K & key)
+  {
+    detail::TreeNode< Key, T > * node = search(key);
+    return node ? iterator(node) : end();
+  }
+
+  template< class Key, class T, class Compare >
+  template< class K, class C, class >
+  TreeConstIterator< Key, T > RedBlackTree< Key, T, Compare >::find(const K & key) const
+  {
+    const detail::TreeNode< Key, T > * node = search(key);
+    return node ? const_iterator(node) : cend();
+  }
+
+  template< class Key, class T, class Compare >
+  template< class K, class C, class >
+  T & RedBlackTree< Key, T, Compare >::at(const K & key)
+  {
+    detail::TreeNode< Key, T > * node = search(key);
+    if (!node)
+    {
+      throw std::out_of_range("Out of range in element access");
+    }
+    return node->data.second;
+  }
+
+  template< class Key, class T, class Compare >
+  template< class K, class C, class >
+  const T & RedBlackTree< Key, T, Compare >::at(const K & key) const
+  {
+    const detail::TreeNode< Key, T > * node = search(key);
+    if (!node)
+    {
+      throw std::out_of_range("Out of range in element access");
+    }
+    return node->data.second;
+  }
+
   template< class Key, class T, class Compare >
   TreeIterator< Key, T > RedBlackTree< Key, T, Compare >::lower_bound(const Key & key)
   {
@@ -838,6 +1040,38 @@ namespace erohin
     return std::make_pair(lower_bound(key), upper_bound(key));
   }
 
+  template< class Key, class T, class Compare >
+  TreeIterator< Key, T > RedBlackTree< Key, T, Compare >::select(size_t index)
+  {
+    return iterator(detail::select_node(root_, index));
+  }
+
+  template< class Key, class T, class Compare >
+  TreeConstIterator< Key, T > RedBlackTree< Key, T, Compare >::select(size_t index) const
+  {
+    return const_iterator(detail::select_node(root_, index));
+  }
+
+  template< class Key, class T, class Compare >
+  size_t RedBlackTree< Key, T, Compare >::rank(const Key & key) const
+  {
+    size_t result = 0;
+    detail::TreeNode< Key, T > * node = root_;
+    while (node)
+    {
+      if (cmp_(node->data.first, key))
+      {
+        result += detail::subtree_size(node->left) + 1;
+        node = node->right;
+      }
+      else
+      {
+        node = node->left;
+      }
+    }
+    return result;
+  }
+
   template< class Key, class T, class Compare >
   template< class F >
   F RedBlackTree< Key, T, Compare >::traverse_lnr(F f) const
@@ -874,6 +1108,29 @@ namespace erohin
     return f;
   }
 
+  template< class Key, class T, class Compare >
+  template< class K >
+  detail::TreeNode< Key, T > * RedBlackTree< Key, T, Compare >::search(const K & key) const
+  {
+    detail::TreeNode< Key, T > * node = root_;
+    while (node)
+    {
+      if (cmp_(key, node->data.first))
+      {
+        node = node->left;
+      }
+      else if (cmp_(node->data.first, key))
+      {
+        node = node->right;
+      }
+      else
+      {
+        return node;
+      }
+    }
+    return nullptr;
+  }
+
   template< class Key, class T, class Compare >
   detail::TreeNode< Key, T > * RedBlackTree< Key, T, Compare >::make_fake_node() const
   {
@@ -892,6 +1149,80 @@ namespace erohin
     delete subtree;
   }
 
+  template< class Key, class T, class Compare >
+  void RedBlackTree< Key, T, Compare >::clear_chain(detail::TreeNode< Key, T > * chain)
+  {
+    while (chain)
+    {
+      detail::TreeNode< Key, T > * next = chain->right;
+      delete chain;
+      chain = next;
+    }
+  }
+
+  template< class Key, class T, class Compare >
+  detail::TreeNode< Key, T > * RedBlackTree< Key, T, Compare >::make_chain(detail::TreeNode< Key, T > * subtree)
+  {
+    if (!subtree)
+    {
+      return nullptr;
+    }
+    while (subtree->left)
+    {
+      subtree = subtree->left;
+    }
+    detail::TreeNode< Key, T > * chain = subtree;
+    while (subtree)
+    {
+      detail::TreeNode< Key, T > * next = subtree->next();
+      subtree->right = next;
+      subtree = next;
+    }
+    return chain;
+  }
+
+  template< class Key, class T, class Compare >
+  void RedBlackTree< Key, T, Compare >::build_from_chain(detail::TreeNode< Key, T > * chain, size_t count)
+  {
+    size_t red_depth = 0;
+    while ((count + 1) >> (red_depth + 1))
+    {
+      ++red_depth;
+    }
+    root_ = build_subtree(chain, count, 0, red_depth);
+    if (root_)
+    {
+      root_->parent = nullptr;
+    }
+    size_ = count;
+  }
+
+  template< class Key, class T, class Compare >
+  detail::TreeNode< Key, T > * RedBlackTree< Key, T, Compare >::build_subtree(detail::TreeNode< Key, T > *& chain,
+    size_t count, size_t depth, size_t red_depth)
+  {
+    if (!count)
+    {
+      return nullptr;
+    }
+    detail::TreeNode< Key, T > * left = build_subtree(chain, (count - 1) / 2, depth + 1, red_depth);
+    detail::TreeNode< Key, T > * node = chain;
+    chain = chain->right;
+    node->left = left;
+    node->right = build_subtree(chain, count - 1 - (count - 1) / 2, depth + 1, red_depth);
+    node->color = (depth < red_depth) ? detail::color_t::BLACK : detail::color_t::RED;
+    node->size = count;
+    if (node->left)
+    {
+      node->left->parent = node;
+    }
+    if (node->right)
+    {
+      node->right->parent = node;
+    }
+    return node;
+  }
+
   template< class Key, class T, class Compare >
   detail::TreeNode< Key, T > * RedBlackTree< Key, T, Compare >::find_to_change_erased(detail::TreeNode< Key, T > * subtree)
   {
@@ -932,12 +1263,6 @@ namespace erohin
     node->color = C;
   }
 
-  template< class Key, class T, class Compare >
-  bool RedBlackTree< Key, T, Compare >::is_leaf(detail::TreeNode< Key, T > * node)
-  {
-    return !(node->left && node->right);
-  }
-
   template< class Key, class T, class Compare >
   detail::TreeNode< Key, T > * RedBlackTree< Key, T, Compare >::find_grandparent(detail::TreeNode< Key, T > * subtree)
   {
@@ -959,7 +1284,7 @@ namespace erohin
     {
       return nullptr;
     }
-    if (node->parent == node->left)
+    if (subtree->parent == node->left)
     {
       return node->right;
     }
@@ -970,15 +1295,32 @@ namespace erohin
   }
 
   template< class Key, class T, class Compare >
-  detail::TreeNode< Key, T > * RedBlackTree< Key, T, Compare >::find_brother(detail::TreeNode< Key, T > * subtree)
+  void RedBlackTree< Key, T, Compare >::increase_path_size(detail::TreeNode< Key, T > * node)
+  {
+    for (node = node->parent; node; node = node->parent)
+    {
+      ++node->size;
+    }
+  }
+
+  template< class Key, class T, class Compare >
+  void RedBlackTree< Key, T, Compare >::transplant(detail::TreeNode< Key, T > * subtree, detail::TreeNode< Key, T > * node)
   {
-    if (subtree == subtree->parent->left)
+    if (!subtree->parent)
     {
-      return subtree->parent->right;
+      root_ = node;
+    }
+    else if (subtree->parent->left == subtree)
+    {
+      subtree->parent->left = node;
     }
     else
     {
-      return subtree->parent->left;
+      subtree->parent->right = node;
+    }
+    if (node)
+    {
+      node->parent = subtree->parent;
     }
   }
 
@@ -1009,6 +1351,8 @@ namespace erohin
     }
     subtree->parent = node;
     node->left = subtree;
+    detail::update_size(subtree);
+    detail::update_size(node);
   }
 
   template< class Key, class T, class Compare >
@@ -1038,6 +1382,8 @@ namespace erohin
     }
     subtree->parent = node;
     node->right = subtree;
+    detail::update_size(subtree);
+    detail::update_size(node);
   }
 
   template< class Key, class T, class Compare >
@@ -1119,117 +1465,69 @@ namespace erohin
   }
 
   template< class Key, class T, class Compare >
-  void RedBlackTree< Key, T, Compare >::erase_balance_case1(detail::TreeNode< Key, T > * subtree)
+  void RedBlackTree< Key, T, Compare >::erase_balance(detail::TreeNode< Key, T > * subtree, detail::TreeNode< Key, T > * parent)
   {
     using namespace detail;
-    if (is_color< BLACK >(subtree) && !is_leaf(subtree))
+    while (subtree != root_ && (!subtree || is_color< BLACK >(subtree)))
     {
-      TreeNode< Key, T > * child = (subtree->right) ? subtree->left : subtree->right;
-      if (is_color< RED >(child))
+      bool is_left = (subtree == parent->left);
+      TreeNode< Key, T > * brother = (is_left) ? parent->right : parent->left;
+      if (is_color< RED >(brother))
       {
-        colorize< BLACK >(child);
-      }
-      else if (subtree->parent)
-      {
-        erase_balance_case2(child);
+        colorize< BLACK >(brother);
+        colorize< RED >(parent);
+        if (is_left)
+        {
+          rotate_left(parent);
+          brother = parent->right;
+        }
+        else
+        {
+          rotate_right(parent);
+          brother = parent->left;
+        }
       }
-    }
-  }
-
-  template< class Key, class T, class Compare >
-  void RedBlackTree< Key, T, Compare >::erase_balance_case2(detail::TreeNode< Key, T > * subtree)
-  {
-    using namespace detail;
-    TreeNode< Key, T > * brother = find_brother(subtree);
-    if (is_color< RED >(brother))
-    {
-      colorize< RED >(subtree->parent);
-      colorize< BLACK >(brother);
-      if (subtree == subtree->parent->left)
+      TreeNode< Key, T > * near = (is_left) ? brother->left : brother->right;
+      TreeNode< Key, T > * far = (is_left) ? brother->right : brother->left;
+      if ((!near || is_color< BLACK >(near)) && (!far || is_color< BLACK >(far)))
       {
-        rotate_left(subtree->parent);
+        colorize< RED >(brother);
+        subtree = parent;
+        parent = subtree->parent;
+        continue;
       }
-      else
+      if (!far || is_color< BLACK >(far))
       {
-        rotate_right(subtree->parent);
+        colorize< BLACK >(near);
+        colorize< RED >(brother);
+        if (is_left)
+        {
+          rotate_right(brother);
+          brother = parent->right;
+        }
+        else
+        {
+          rotate_left(brother);
+          brother = parent->left;
+        }
+        far = (is_left) ? brother->right : brother->left;
       }
-    }
-    erase_balance_case3(subtree);
-  }
-
-  template< class Key, class T, class Compare >
-  void RedBlackTree< Key, T, Compare >::erase_balance_case3(detail::TreeNode< Key, T > * subtree)
-  {
-    using namespace detail;
-    TreeNode< Key, T > * brother = find_brother(subtree);
-    bool is_any_child_black = is_color< BLACK >(brother->left) && is_color< BLACK >(brother->right);
-    if (is_color< BLACK >(subtree->parent) && is_color< BLACK >(brother) && is_any_child_black)
-    {
-      colorize< RED >(brother);
-      erase_balance_case1(subtree->parent);
-    }
-    else
-    {
-      erase_balance_case4(subtree);
-    }
-  }
-
-  template< class Key, class T, class Compare >
-  void RedBlackTree< Key, T, Compare >::erase_balance_case4(detail::TreeNode< Key, T > * subtree)
-  {
-    using namespace detail;
-    TreeNode< Key, T > * brother = find_brother(subtree);
-    bool is_any_child_black = is_color< BLACK >(brother->left) && is_color< BLACK >(brother->right);
-    if (is_color< RED >(subtree->parent) && is_color< BLACK >(brother) && is_any_child_black)
-    {
-      colorize< RED >(brother);
-      colorize< BLACK >(subtree->parent);
-    }
-    else
-    {
-      erase_balance_case5(subtree);
-    }
-  }
-
-  template< class Key, class T, class Compare >
-  void RedBlackTree< Key, T, Compare >::erase_balance_case5(detail::TreeNode< Key, T > * subtree)
-  {
-    using namespace detail;
-    TreeNode< Key, T > * brother = find_brother(subtree);
-    if (is_color< BLACK >(brother))
-    {
-      if (subtree == subtree->parent->left && is_color< BLACK >(brother->right) && is_color< RED >(brother->left))
+      brother->color = parent->color;
+      colorize< BLACK >(parent);
+      colorize< BLACK >(far);
+      if (is_left)
       {
-        colorize< RED >(brother);
-        colorize< BLACK >(brother->left);
-        rotate_right(brother);
+        rotate_left(parent);
       }
-      else if (subtree == subtree->parent->right && is_color< RED >(brother->right) && is_color< BLACK >(brother->left))
+      else
       {
-        colorize< RED >(brother);
-        colorize< BLACK >(brother->right);
-        rotate_left(brother);
+        rotate_right(parent);
       }
+      subtree = root_;
     }
-    erase_balance_case6(subtree);
-  }
-
-  template< class Key, class T, class Compare >
-  void RedBlackTree< Key, T, Compare >::erase_balance_case6(detail::TreeNode< Key, T > * subtree)
-  {
-    using namespace detail;
-    TreeNode< Key, T > * brother = find_brother(subtree);
-    brother->color = subtree->parent->color;
-    colorize< BLACK >(subtree->parent);
-    if (subtree == subtree->parent->left)
-    {
-      colorize< BLACK >(brother->right);
-      rotate_left(subtree->parent);
-    }
-    else
+    if (subtree)
     {
-      colorize< BLACK >(brother->left);
-      rotate_right(subtree->parent);
+      colorize< BLACK >(subtree);
     }
   }
 }
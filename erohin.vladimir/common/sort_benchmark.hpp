@@ -0,0 +1,259 @@
+#ifndef SORT_BENCHMARK_HPP
+#define SORT_BENCHMARK_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace erohin
+{
+  enum distribution_t
+  {
+    UNIFORM,
+    SORTED,
+    REVERSED,
+    FEW_UNIQUE,
+    ORGAN_PIPE
+  };
+
+  namespace detail
+  {
+    struct SortCounters
+    {
+      size_t comparisons;
+      size_t moves;
+      size_t alive;
+      size_t peak_alive;
+    };
+
+    template< class T >
+    SortCounters & getSortCounters()
+    {
+      static SortCounters counters{ 0, 0, 0, 0 };
+      return counters;
+    }
+
+    template< class T >
+    class CountedValue
+    {
+    public:
+      CountedValue():
+        value_()
+      {
+        born();
+      }
+      CountedValue(const T & value):
+        value_(value)
+      {
+        born();
+      }
+      CountedValue(const CountedValue & other):
+        value_(other.value_)
+      {
+        born();
+        ++getSortCounters< T >().moves;
+      }
+      CountedValue(CountedValue && other) noexcept:
+        value_(std::move(other.value_))
+      {
+        born();
+        ++getSortCounters< T >().moves;
+      }
+      ~CountedValue()
+      {
+        --getSortCounters< T >().alive;
+      }
+      CountedValue & operator=(const CountedValue & other)
+      {
+        value_ = other.value_;
+        ++getSortCounters< T >().moves;
+        return *this;
+      }
+      CountedValue & operator=(CountedValue && other) noexcept
+      {
+        value_ = std::move(other.value_);
+        ++getSortCounters< T >().moves;
+        return *this;
+      }
+      const T & get() const
+      {
+        return value_;
+      }
+    private:
+      T value_;
+      void born()
+      {
+        SortCounters & counters = getSortCounters< T >();
+        counters.peak_alive = std::max(counters.peak_alive, ++counters.alive);
+      }
+    };
+
+    template< class T, class Compare >
+    struct CountedCompare
+    {
+      Compare cmp;
+      bool operator()(const CountedValue< T > & lhs, const CountedValue< T > & rhs) const
+      {
+        ++getSortCounters< T >().comparisons;
+        return cmp(lhs.get(), rhs.get());
+      }
+    };
+
+    template< class T >
+    const T & getValue(const T & value)
+    {
+      return value;
+    }
+
+    template< class T >
+    const T & getValue(const CountedValue< T > & value)
+    {
+      return value.get();
+    }
+  }
+
+  template< class T >
+  void generateSequence(std::vector< T > & seq, size_t size, distribution_t distribution)
+  {
+    seq.clear();
+    seq.reserve(size);
+    for (size_t i = 0; i < size; ++i)
+    {
+      size_t value = 0;
+      switch (distribution)
+      {
+      case UNIFORM:
+        value = static_cast< size_t >(std::rand()) % (2 * size + 1);
+        break;
+      case SORTED:
+        value = i;
+        break;
+      case REVERSED:
+        value = size - i;
+        break;
+      case FEW_UNIQUE:
+        value = static_cast< size_t >(std::rand()) % 16;
+        break;
+      case ORGAN_PIPE:
+        value = (i < size / 2) ? i : size - i;
+        break;
+      }
+      seq.push_back(static_cast< T >(static_cast< long long >(value) - static_cast< long long >(size)));
+    }
+  }
+
+  struct SortMeasurement
+  {
+    double ns_per_element;
+    size_t comparisons;
+    size_t moves;
+    size_t peak_extra_bytes;
+  };
+
+  template< class T, class Compare >
+  class SortBenchmark
+  {
+  public:
+    explicit SortBenchmark(std::string type_name);
+    template< template< class... > class Container, class Sort >
+    void add(std::string container_name, std::string sort_name, Sort sort, size_t max_size);
+    void run(std::ostream & output, const std::vector< size_t > & sizes) const;
+  private:
+    using measure_func = std::function< SortMeasurement(const std::vector< T > &) >;
+    struct Case
+    {
+      std::string container_name;
+      std::string sort_name;
+      size_t max_size;
+      measure_func measure;
+    };
+    std::string type_name_;
+    std::vector< Case > cases_;
+  };
+
+  template< class T, class Compare >
+  SortBenchmark< T, Compare >::SortBenchmark(std::string type_name):
+    type_name_(std::move(type_name)),
+    cases_()
+  {}
+
+  template< class T, class Compare >
+  template< template< class... > class Container, class Sort >
+  void SortBenchmark< T, Compare >::add(std::string container_name, std::string sort_name, Sort sort, size_t max_size)
+  {
+    measure_func measure = [sort](const std::vector< T > & source)
+    {
+      using counted_t = detail::CountedValue< T >;
+      auto is_sorted = [](auto & seq)
+      {
+        auto prev = seq.begin();
+        for (auto iter = seq.begin(); iter != seq.end(); prev = iter++)
+        {
+          if (Compare{}(detail::getValue(*iter), detail::getValue(*prev)))
+          {
+            return false;
+          }
+        }
+        return true;
+      };
+      SortMeasurement result{ 0.0, 0, 0, 0 };
+      {
+        Container< T > seq(source.begin(), source.end());
+        auto start = std::chrono::steady_clock::now();
+        sort(seq, Compare{});
+        std::chrono::duration< double, std::nano > elapsed = std::chrono::steady_clock::now() - start;
+        result.ns_per_element = elapsed.count() / std::max< size_t >(source.size(), 1);
+        if (!is_sorted(seq))
+        {
+          throw std::logic_error("Sort benchmark: sequence is not sorted");
+        }
+      }
+      {
+        Container< counted_t > seq(source.begin(), source.end());
+        detail::SortCounters & counters = detail::getSortCounters< T >();
+        size_t alive = counters.alive;
+        counters = detail::SortCounters{ 0, 0, alive, alive };
+        sort(seq, detail::CountedCompare< T, Compare >{ Compare{} });
+        result.comparisons = counters.comparisons;
+        result.moves = counters.moves;
+        result.peak_extra_bytes = (counters.peak_alive - alive) * sizeof(counted_t);
+      }
+      return result;
+    };
+    cases_.push_back(Case{ std::move(container_name), std::move(sort_name), max_size, std::move(measure) });
+  }
+
+  template< class T, class Compare >
+  void SortBenchmark< T, Compare >::run(std::ostream & output, const std::vector< size_t > & sizes) const
+  {
+    const char * distribution_names[] = { "uniform", "sorted", "reversed", "few_unique", "organ_pipe" };
+    const distribution_t distributions[] = { UNIFORM, SORTED, REVERSED, FEW_UNIQUE, ORGAN_PIPE };
+    std::vector< T > source;
+    for (size_t size: sizes)
+    {
+      for (size_t i = 0; i < 5; ++i)
+      {
+        generateSequence(source, size, distributions[i]);
+        for (const Case & sort_case: cases_)
+        {
+          if (size > sort_case.max_size)
+          {
+            continue;
+          }
+          SortMeasurement result = sort_case.measure(source);
+          output << type_name_ << "," << sort_case.container_name << "," << sort_case.sort_name << ",";
+          output << distribution_names[i] << "," << size << "," << result.ns_per_element << ",";
+          output << result.comparisons << "," << result.moves << "," << result.peak_extra_bytes << "\n";
+        }
+      }
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,212 @@
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace erohin
+{
+  class ThreadPool
+  {
+  public:
+    explicit ThreadPool(size_t thread_count);
+    ThreadPool(const ThreadPool &) = delete;
+    ~ThreadPool();
+    ThreadPool & operator=(const ThreadPool &) = delete;
+    size_t size() const noexcept;
+    void submit(std::function< void() > task);
+    bool runPending();
+  private:
+    std::vector< std::thread > workers_;
+    std::deque< std::function< void() > > tasks_;
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    bool is_stopped_;
+    void work();
+  };
+
+  class TaskGroup
+  {
+  public:
+    explicit TaskGroup(ThreadPool & pool);
+    TaskGroup(const TaskGroup &) = delete;
+    ~TaskGroup();
+    TaskGroup & operator=(const TaskGroup &) = delete;
+    template< class F >
+    void run(F func);
+    void wait();
+  private:
+    ThreadPool & pool_;
+    std::atomic< size_t > pending_;
+    std::mutex error_mutex_;
+    std::exception_ptr error_;
+  };
+
+  inline ThreadPool::ThreadPool(size_t thread_count):
+    workers_(),
+    tasks_(),
+    mutex_(),
+    condition_(),
+    is_stopped_(false)
+  {
+    try
+    {
+      for (size_t i = 1; i < thread_count; ++i)
+      {
+        workers_.emplace_back(&ThreadPool::work, this);
+      }
+    }
+    catch (...)
+    {
+      {
+        std::lock_guard< std::mutex > lock(mutex_);
+        is_stopped_ = true;
+      }
+      condition_.notify_all();
+      for (std::thread & worker: workers_)
+      {
+        worker.join();
+      }
+      throw;
+    }
+  }
+
+  inline ThreadPool::~ThreadPool()
+  {
+    {
+      std::lock_guard< std::mutex > lock(mutex_);
+      is_stopped_ = true;
+    }
+    condition_.notify_all();
+    for (std::thread & worker: workers_)
+    {
+      worker.join();
+    }
+  }
+
+  inline size_t ThreadPool::size() const noexcept
+  {
+    return workers_.size() + 1;
+  }
+
+  inline void ThreadPool::submit(std::function< void() > task)
+  {
+    {
+      std::lock_guard< std::mutex > lock(mutex_);
+      tasks_.push_back(std::move(task));
+    }
+    condition_.notify_one();
+  }
+
+  inline bool ThreadPool::runPending()
+  {
+    std::function< void() > task;
+    {
+      std::lock_guard< std::mutex > lock(mutex_);
+      if (tasks_.empty())
+      {
+        return false;
+      }
+      task = std::move(tasks_.front());
+      tasks_.pop_front();
+    }
+    task();
+    return true;
+  }
+
+  inline void ThreadPool::work()
+  {
+    while (true)
+    {
+      std::function< void() > task;
+      {
+        std::unique_lock< std::mutex > lock(mutex_);
+        condition_.wait(lock, [this]()
+        {
+          return is_stopped_ || !tasks_.empty();
+        });
+        if (tasks_.empty())
+        {
+          return;
+        }
+        task = std::move(tasks_.front());
+        tasks_.pop_front();
+      }
+      task();
+    }
+  }
+
+  inline TaskGroup::TaskGroup(ThreadPool & pool):
+    pool_(pool),
+    pending_(0),
+    error_mutex_(),
+    error_()
+  {}
+
+  inline TaskGroup::~TaskGroup()
+  {
+    while (pending_ > 0)
+    {
+      if (!pool_.runPending())
+      {
+        std::this_thread::yield();
+      }
+    }
+  }
+
+  template< class F >
+  void TaskGroup::run(F func)
+  {
+    ++pending_;
+    try
+    {
+      pool_.submit([this, func]()
+      {
+        try
+        {
+          func();
+        }
+        catch (...)
+        {
+          std::lock_guard< std::mutex > lock(error_mutex_);
+          if (!error_)
+          {
+            error_ = std::current_exception();
+          }
+        }
+        --pending_;
+      });
+    }
+    catch (...)
+    {
+      --pending_;
+      throw;
+    }
+  }
+
+  inline void TaskGroup::wait()
+  {
+    while (pending_ > 0)
+    {
+      if (!pool_.runPending())
+      {
+        std::this_thread::yield();
+      }
+    }
+    std::lock_guard< std::mutex > lock(error_mutex_);
+    if (error_)
+    {
+      std::exception_ptr error = error_;
+      error_ = nullptr;
+      std::rethrow_exception(error);
+    }
+  }
+}
+
+#endif
@@ -48,6 +48,8 @@ namespace erohin
     TreeConstIterator< Key, T > operator++(int);
     TreeConstIterator< Key, T > & operator--();
     TreeConstIterator< Key, T > operator--(int);
+    TreeConstIterator< Key, T > & operator+=(size_t count);
+    TreeConstIterator< Key, T > operator+(size_t count) const;
     const std::pair< Key, T > & operator*() const;
     const std::pair< Key, T > * operator->() const;
     bool operator==(const TreeConstIterator< Key, T > & rhs) const;
@@ -112,6 +114,23 @@ namespace erohin
     return temp;
   }
 
+  template< class Key, class T >
+  TreeConstIterator< Key, T > & TreeConstIterator< Key, T >::operator+=(size_t count)
+  {
+    if (count)
+    {
+      node_ = const_cast< detail::TreeNode< Key, T > * >(node_)->next(count);
+    }
+    return *this;
+  }
+
+  template< class Key, class T >
+  TreeConstIterator< Key, T > TreeConstIterator< Key, T >::operator+(size_t count) const
+  {
+    TreeConstIterator< Key, T > temp = *this;
+    return temp += count;
+  }
+
   template< class Key, class T >
   const std::pair< Key, T > & TreeConstIterator< Key, T>::operator*() const
   {
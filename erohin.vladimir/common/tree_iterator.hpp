@@ -51,6 +51,8 @@ namespace erohin
     TreeIterator< Key, T > operator++(int);
     TreeIterator< Key, T > & operator--();
     TreeIterator< Key, T > operator--(int);
+    TreeIterator< Key, T > & operator+=(size_t count);
+    TreeIterator< Key, T > operator+(size_t count) const;
     std::pair< Key, T > & operator*();
     const std::pair< Key, T > & operator*() const;
     std::pair< Key, T > * operator->();
@@ -117,6 +119,23 @@ namespace erohin
     return temp;
   }
 
+  template< class Key, class T >
+  TreeIterator< Key, T > & TreeIterator< Key, T >::operator+=(size_t count)
+  {
+    if (count)
+    {
+      node_ = node_->next(count);
+    }
+    return *this;
+  }
+
+  template< class Key, class T >
+  TreeIterator< Key, T > TreeIterator< Key, T >::operator+(size_t count) const
+  {
+    TreeIterator< Key, T > temp = *this;
+    return temp += count;
+  }
+
   template< class Key, class T >
   std::pair< Key, T > & TreeIterator< Key, T>::operator*()
   {
@@ -22,13 +22,50 @@ namespace erohin
       TreeNode * left;
       TreeNode * right;
       color_t color;
+      size_t size;
       template< class... Args >
       TreeNode(TreeNode * parent_node, TreeNode * left_node, TreeNode * right_node, Args &&... args);
       ~TreeNode() = default;
       TreeNode * next();
+      TreeNode * next(size_t count);
       TreeNode * prev();
     };
 
+    template< class Key, class T >
+    size_t subtree_size(const TreeNode< Key, T > * node)
+    {
+      return (node) ? node->size : 0;
+    }
+
+    template< class Key, class T >
+    void update_size(TreeNode< Key, T > * node)
+    {
+      node->size = 1 + subtree_size(node->left) + subtree_size(node->right);
+    }
+
+    template< class Key, class T >
+    TreeNode< Key, T > * select_node(TreeNode< Key, T > * node, size_t index)
+    {
+      while (node)
+      {
+        size_t left_size = subtree_size(node->left);
+        if (index == left_size)
+        {
+          return node;
+        }
+        else if (index < left_size)
+        {
+          node = node->left;
+        }
+        else
+        {
+          index -= left_size + 1;
+          node = node->right;
+        }
+      }
+      return nullptr;
+    }
+
     template< class Key, class T >
     template< class... Args >
     TreeNode< Key, T >::TreeNode(TreeNode * parent_node, TreeNode * left_node, TreeNode * right_node, Args &&... args):
@@ -36,7 +73,8 @@ namespace erohin
       parent(parent_node),
       left(left_node),
       right(right_node),
-      color(color_t::RED)
+      color(color_t::RED),
+      size(1)
     {}
 
     template< class Key, class T >
@@ -66,6 +104,27 @@ namespace erohin
       return node;
     }
 
+    template< class Key, class T >
+    TreeNode< Key, T > * TreeNode< Key, T >::next(size_t count)
+    {
+      TreeNode< Key, T > * node = this;
+      while (node && count)
+      {
+        size_t right_size = subtree_size(node->right);
+        if (count <= right_size)
+        {
+          return select_node(node->right, count - 1);
+        }
+        count -= right_size + 1;
+        while (node->parent && node->parent->right == node)
+        {
+          node = node->parent;
+        }
+        node = node->parent;
+      }
+      return node;
+    }
+
     template< class Key, class T >
     TreeNode< Key, T > * TreeNode< Key, T >::prev()
     {
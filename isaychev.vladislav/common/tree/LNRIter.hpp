@@ -1,7 +1,8 @@
 #ifndef LNRITER_HPP
 #define LNRITER_HPP
 
-#include <stack.hpp>
+#include <iterator>
+#include "treeNode.hpp"
 
 namespace isaychev
 {
@@ -35,53 +36,24 @@ namespace isaychev
 
    private:
     node_t * current_;
-    Stack< node_t * > stack_;
 
     friend class BSTree< Key, Value, Compare >;
     friend class RNLIter< Key, Value, Compare >;
 
-    LNRIter(node_t * node, Stack< node_t * > && s);
+    explicit LNRIter(node_t * node);
   };
 
   template < class Key, class Value, class Compare >
-  LNRIter< Key, Value, Compare >:: LNRIter(node_t * node, Stack< node_t * > && s):
-   current_(node),
-   stack_(s)
+  LNRIter< Key, Value, Compare >::LNRIter(node_t * node):
+   current_(node)
   {}
 
   template < class Key, class Value, class Compare >
   LNRIter< Key, Value, Compare > & LNRIter< Key, Value, Compare >::operator++()
   {
-    if (!current_)
+    if (current_)
     {
-      return *this;
-    }
-    if (current_->right)
-    {
-      stack_.push(current_);
-      current_ = current_->right;
-      while (current_->left)
-      {
-        stack_.push(current_);
-        current_ = current_->left;
-      }
-    }
-    else
-    {
-      while (!stack_.empty() && stack_.top()->right == current_)
-      {
-        current_ = stack_.top();
-        stack_.pop();
-        if (stack_.empty())
-        {
-          current_ = nullptr;
-        }
-      }
-      if (!stack_.empty() && stack_.top()->left == current_)
-      {
-        current_ = stack_.top();
-        stack_.pop();
-      }
+      current_ = detail::next_node(current_);
     }
     return *this;
   }
@@ -97,36 +69,9 @@ namespace isaychev
   template < class Key, class Value, class Compare >
   LNRIter< Key, Value, Compare > & LNRIter< Key, Value, Compare >::operator--()
   {
-    if (!current_)
-    {
-      return *this;
-    }
-    if (current_->left)
-    {
-      stack_.push(current_);
-      current_ = current_->left;
-      while (current_->right)
-      {
-        stack_.push(current_);
-        current_ = current_->right;
-      }
-    }
-    else
+    if (current_)
     {
-      while (!stack_.empty() && stack_.top()->left == current_)
-      {
-        current_ = stack_.top();
-        stack_.pop();
-        if (stack_.empty())
-        {
-          current_ = nullptr;
-        }
-      }
-      if (!stack_.empty() && stack_.top()->right == current_)
-      {
-        current_ = stack_.top();
-        stack_.pop();
-      }
+      current_ = detail::prev_node(current_);
     }
     return *this;
   }
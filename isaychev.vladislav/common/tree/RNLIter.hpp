@@ -1,8 +1,8 @@
 #ifndef RNLITER_HPP
 #define RNLITER_HPP
 
-#include <stack.hpp>
-#include "LNRIter.hpp"
+#include <iterator>
+#include "treeNode.hpp"
 
 namespace isaychev
 {
@@ -32,21 +32,24 @@ namespace isaychev
     const std::pair< Key, Value > * operator->() const;
 
    private:
-    LNRIter< Key, Value, Compare > it_;
+    node_t * current_;
 
     friend class BSTree< Key, Value, Compare >;
-    RNLIter(node_t * node, Stack< node_t * > && s);
+    explicit RNLIter(node_t * node);
   };
 
   template < class Key, class Value, class Compare >
-  RNLIter< Key, Value, Compare >:: RNLIter(node_t * node, Stack< node_t * > && s):
-   it_(node, std::forward(s))
+  RNLIter< Key, Value, Compare >::RNLIter(node_t * node):
+   current_(node)
   {}
 
   template < class Key, class Value, class Compare >
   RNLIter< Key, Value, Compare > & RNLIter< Key, Value, Compare >::operator++()
   {
-    --it_;
+    if (current_)
+    {
+      current_ = detail::prev_node(current_);
+    }
     return *this;
   }
 
@@ -61,7 +64,10 @@ namespace isaychev
   template < class Key, class Value, class Compare >
   RNLIter< Key, Value, Compare > & RNLIter< Key, Value, Compare >::operator--()
   {
-    ++it_;
+    if (current_)
+    {
+      current_ = detail::next_node(current_);
+    }
     return *this;
   }
 
@@ -76,7 +82,7 @@ namespace isaychev
   template < class Key, class Value, class Compare >
   bool RNLIter< Key, Value, Compare >::operator==(const this_t & rhs) const noexcept
   {
-    return it_ == rhs.it_;
+    return current_ == rhs.current_;
   }
 
   template < class Key, class Value, class Compare >
@@ -88,25 +94,25 @@ namespace isaychev
   template < class Key, class Value, class Compare >
   std::pair< Key, Value > & RNLIter< Key, Value, Compare >::operator*()
   {
-    return *it_;
+    return current_->data;
   }
 
   template < class Key, class Value, class Compare >
   const std::pair< Key, Value > & RNLIter< Key, Value, Compare >::operator*() const
   {
-    return *it_;
+    return current_->data;
   }
 
   template < class Key, class Value, class Compare >
   std::pair< Key, Value > * RNLIter< Key, Value, Compare >::operator->()
   {
-    return it_.operator->();
+    return std::addressof(current_->data);
   }
 
   template < class Key, class Value, class Compare >
   const std::pair< Key, Value > * RNLIter< Key, Value, Compare >::operator->() const
   {
-    return it_.operator->();
+    return std::addressof(current_->data);
   }
 }
 
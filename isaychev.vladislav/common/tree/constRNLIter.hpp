@@ -1,8 +1,8 @@
 #ifndef CONSTRNLITER_HPP
 #define CONSTRNLITER_HPP
 
-#include <stack.hpp>
-#include "constLNRIter.hpp"
+#include <iterator>
+#include "treeNode.hpp"
 
 namespace isaychev
 {
@@ -30,21 +30,24 @@ namespace isaychev
     const std::pair< Key, Value > * operator->() const;
 
    private:
-    ConstLNRIter< Key, Value, Compare > it_;
+    const node_t * current_;
     friend class BSTree< Key, Value, Compare >;
 
-    ConstRNLIter(const node_t * node, Stack< const node_t * > && s);
+    explicit ConstRNLIter(const node_t * node);
   };
 
   template < class Key, class Value, class Compare >
-  ConstRNLIter< Key, Value, Compare >::ConstRNLIter(const node_t * node, Stack< const node_t * > && s):
-   it_(node, std::move(s))
+  ConstRNLIter< Key, Value, Compare >::ConstRNLIter(const node_t * node):
+   current_(node)
   {}
 
   template < class Key, class Value, class Compare >
   ConstRNLIter< Key, Value, Compare > & ConstRNLIter< Key, Value, Compare >::operator++()
   {
-    --it_;
+    if (current_)
+    {
+      current_ = detail::prev_node(current_);
+    }
     return *this;
   }
 
@@ -59,7 +62,10 @@ namespace isaychev
   template < class Key, class Value, class Compare >
   ConstRNLIter< Key, Value, Compare > & ConstRNLIter< Key, Value, Compare >::operator--()
   {
-    ++it_;
+    if (current_)
+    {
+      current_ = detail::next_node(current_);
+    }
     return *this;
   }
 
@@ -74,7 +80,7 @@ namespace isaychev
   template < class Key, class Value, class Compare >
   bool ConstRNLIter< Key, Value, Compare >::operator==(const this_t & rhs) const noexcept
   {
-    return it_ == rhs.it_;
+    return current_ == rhs.current_;
   }
 
   template < class Key, class Value, class Compare >
@@ -86,13 +92,13 @@ namespace isaychev
   template < class Key, class Value, class Compare >
   const std::pair< Key, Value > & ConstRNLIter< Key, Value, Compare >::operator*() const
   {
-    return *it_;
+    return current_->data;
   }
 
   template < class Key, class Value, class Compare >
   const std::pair< Key, Value > * ConstRNLIter< Key, Value, Compare >::operator->() const
   {
-    return it_.operator->();
+    return std::addressof(current_->data);
   }
 }
 
@@ -222,115 +222,73 @@ namespace isaychev
   template < class Key, class Value, class Compare >
   LNRIter< Key, Value, Compare > BSTree< Key, Value, Compare >::lnrbegin()
   {
-    Stack< node_t * > s;
-    auto curr = root_;
-    while (curr && curr->left)
-    {
-      s.push(curr);
-      curr = curr->left;
-    }
-    return lnr_iterator(curr, std::move(s));
+    return lnr_iterator(detail::traverse_left(root_));
   }
 
   template < class Key, class Value, class Compare >
   LNRIter< Key, Value, Compare > BSTree< Key, Value, Compare >::lnrend()
   {
-    return lnr_iterator(nullptr, Stack< node_t * >());
+    return lnr_iterator(nullptr);
   }
 
   template < class Key, class Value, class Compare >
   ConstLNRIter< Key, Value, Compare > BSTree< Key, Value, Compare >::lnrbegin() const
   {
-    Stack< node_t * > s;
-    auto curr = root_;
-    while (curr && curr->left)
-    {
-      s.push(curr);
-      curr = curr->left;
-    }
-    return const_lnr_iterator(curr, std::move(s));
+    return const_lnr_iterator(detail::traverse_left(root_));
   }
 
   template < class Key, class Value, class Compare >
   ConstLNRIter< Key, Value, Compare > BSTree< Key, Value, Compare >::lnrend() const
   {
-    return const_lnr_iterator(nullptr, Stack< node_t * >());
+    return const_lnr_iterator(nullptr);
   }
 
   template < class Key, class Value, class Compare >
   ConstLNRIter< Key, Value, Compare > BSTree< Key, Value, Compare >::clnrbegin() const
   {
-    Stack< const node_t * > s;
-    auto curr = root_;
-    while (curr && curr->left)
-    {
-      s.push(curr);
-      curr = curr->left;
-    }
-    return const_lnr_iterator(curr, std::move(s));
+    return const_lnr_iterator(detail::traverse_left(root_));
   }
 
   template < class Key, class Value, class Compare >
   ConstLNRIter< Key, Value, Compare > BSTree< Key, Value, Compare >::clnrend() const
   {
-    return const_lnr_iterator(nullptr, Stack< const node_t * >());
+    return const_lnr_iterator(nullptr);
   }
 
   template < class Key, class Value, class Compare >
   RNLIter< Key, Value, Compare > BSTree< Key, Value, Compare >::rnlbegin()
   {
-    Stack< node_t * > s;
-    auto curr = root_;
-    while (curr && curr->right)
-    {
-      s.push(curr);
-      curr = curr->right;
-    }
-    return rnl_iterator(curr, std::move(s));
+    return rnl_iterator(detail::traverse_right(root_));
   }
 
   template < class Key, class Value, class Compare >
   RNLIter< Key, Value, Compare > BSTree< Key, Value, Compare >::rnlend()
   {
-    return rnl_iterator(nullptr, Stack< node_t * >());
+    return rnl_iterator(nullptr);
   }
 
   template < class Key, class Value, class Compare >
   ConstRNLIter< Key, Value, Compare > BSTree< Key, Value, Compare >::rnlbegin() const
   {
-    Stack< const node_t * > s;
-    auto curr = root_;
-    while (curr && curr->right)
-    {
-      s.push(curr);
-      curr = curr->right;
-    }
-    return const_rnl_iterator(curr, std::move(s));
+    return const_rnl_iterator(detail::traverse_right(root_));
   }
 
   template < class Key, class Value, class Compare >
   ConstRNLIter< Key, Value, Compare > BSTree< Key, Value, Compare >::rnlend() const
   {
-    return const_rnl_iterator(nullptr, Stack< const node_t * >());
+    return const_rnl_iterator(nullptr);
   }
 
   template < class Key, class Value, class Compare >
   ConstRNLIter< Key, Value, Compare > BSTree< Key, Value, Compare >::crnlbegin() const
   {
-    Stack< const node_t * > s;
-    auto curr = root_;
-    while (curr && curr->right)
-    {
-      s.push(curr);
-      curr = curr->right;
-    }
-    return const_rnl_iterator(curr, std::move(s));
+    return const_rnl_iterator(detail::traverse_right(root_));
   }
 
   template < class Key, class Value, class Compare >
   ConstRNLIter< Key, Value, Compare > BSTree< Key, Value, Compare >::crnlend() const
   {
-    return const_rnl_iterator(nullptr, Stack< const node_t * >());
+    return const_rnl_iterator(nullptr);
   }
 
   template < class Key, class Value, class Compare >
@@ -132,7 +132,7 @@ namespace isaychev
     }
     else if (current_->left)
     {
-      current_= detail::traverse_right(current_->right);
+      current_= detail::traverse_right(current_->left);
     }
     else
     {
@@ -51,6 +51,44 @@ namespace isaychev
     {
       return current->parent;
     }
+
+    template < class Node >
+    Node * next_node(Node * current)
+    {
+      if (current->right)
+      {
+        current = current->right;
+        while (current->left)
+        {
+          current = current->left;
+        }
+        return current;
+      }
+      while (current->parent && current == current->parent->right)
+      {
+        current = current->parent;
+      }
+      return current->parent;
+    }
+
+    template < class Node >
+    Node * prev_node(Node * current)
+    {
+      if (current->left)
+      {
+        current = current->left;
+        while (current->right)
+        {
+          current = current->right;
+        }
+        return current;
+      }
+      while (current->parent && current == current->parent->left)
+      {
+        current = current->parent;
+      }
+      return current->parent;
+    }
   }
 }
 
@@ -1,35 +1,61 @@
 #include <iostream>
 #include <cstddef>
+#include <cerrno>
+#include <cstdlib>
+#include <memory>
+#include <stdexcept>
 #include <string>
-#include <utility>
 #include <limits>
 #include <node.hpp>
 #include <list_iterator.hpp>
 #include <const_list_iterator.hpp>
 #include <list.hpp>
+#include <ring_buffer.hpp>
 
-using listOfPairs = lopatina::List< std::pair< std::string, lopatina::List< size_t > > >;
+struct Sequences
+{
+  lopatina::List< std::string > names;
+  lopatina::RingBuffer< size_t > values;
+  lopatina::RingBuffer< size_t > offsets;
+};
 
-size_t inputListOfPairs(std::istream & in, listOfPairs & list)
+size_t parseNumbers(const std::string & line, lopatina::RingBuffer< size_t > & values)
+{
+  size_t count = 0;
+  const char * cursor = line.c_str();
+  const char * end = cursor + line.size();
+  while (cursor != end)
+  {
+    char * next = nullptr;
+    errno = 0;
+    unsigned long long number = std::strtoull(cursor, std::addressof(next), 10);
+    if (next == cursor)
+    {
+      throw std::invalid_argument("stoull");
+    }
+    if (errno == ERANGE)
+    {
+      throw std::out_of_range("stoull");
+    }
+    values.push_back(number);
+    ++count;
+    cursor = next;
+  }
+  return count;
+}
+
+size_t inputSequences(std::istream & in, Sequences & sequences)
 {
   std::string name = "";
   std::string num_str = "";
   size_t max_size = 0;
+  sequences.offsets.push_back(0);
   while (in >> name)
   {
-    size_t loc_size = 0;
-    lopatina::List< size_t > list_num;
     std::getline(in, num_str);
-    size_t idx = 0;
-    while (!num_str.empty())
-    {
-      size_t number = 0;
-      number = std::stoull(num_str, &idx);
-      num_str = num_str.substr(idx);
-      list_num.push_back(number);
-      loc_size += 1;
-    }
-    list.push_back(std::make_pair(name, list_num));
+    sequences.names.push_back(name);
+    size_t loc_size = parseNumbers(num_str, sequences.values);
+    sequences.offsets.push_back(sequences.values.size());
     if (loc_size > max_size)
     {
       max_size = loc_size;
@@ -39,10 +65,10 @@ size_t inputListOfPairs(std::istream & in, listOfPairs & list)
 }
 
 template < typename T >
-void outputList(std::ostream & out, lopatina::List< T > list)
+void outputList(std::ostream & out, const lopatina::List< T > & list)
 {
   out << list.front();
-  for (auto iter = ++(list.begin()); iter != list.end(); ++iter)
+  for (auto iter = ++(list.cbegin()); iter != list.cend(); ++iter)
   {
     out << ' ' << *iter;
   }
@@ -51,21 +77,15 @@ void outputList(std::ostream & out, lopatina::List< T > list)
 int main()
 {
   using namespace lopatina;
-  List< std::pair< std::string, List< size_t > > > list;
-  size_t max_size = inputListOfPairs(std::cin, list);
+  Sequences sequences;
+  size_t max_size = inputSequences(std::cin, sequences);
 
-  if (list.empty())
+  if (sequences.names.empty())
   {
     std::cout << "0\n";
     return 0;
   }
 
-  List< std::string > list_names;
-  for (auto iter = list.begin(); iter != list.end(); ++iter)
-  {
-    list_names.push_back((*iter).first);
-  }
-
   List< size_t > list_sums;
   if (max_size == 0)
   {
@@ -74,42 +94,34 @@ int main()
 
   bool overflow = false;
 
-  List< List< size_t > > list_nums;
+  outputList(std::cout, sequences.names);
+  std::cout << '\n';
+  const size_t count = sequences.offsets.size() - 1;
   for (size_t i = 0; i < max_size; ++i)
   {
     size_t sum = 0;
-    List< size_t > list_num;
-    for (auto iter = list.begin(); iter != list.end(); ++iter)
+    bool first = true;
+    for (size_t seq = 0; seq < count; ++seq)
     {
-      List< size_t > sub_list = (*iter).second;
-      size_t size = 0;
-      for (auto sub_iter = sub_list.begin(); sub_iter != sub_list.end(); ++sub_iter)
+      size_t pos = sequences.offsets[seq] + i;
+      if (pos >= sequences.offsets[seq + 1])
+      {
+        continue;
+      }
+      size_t value = sequences.values[pos];
+      if ((std::numeric_limits< unsigned long long >::max() - sum) >= value)
+      {
+        sum += value;
+      }
+      else
       {
-        if (size == i)
-        {
-          if ((std::numeric_limits< unsigned long long >::max() - sum) >= *sub_iter)
-          {
-            sum += *sub_iter;
-          }
-          else
-          {
-            overflow = true;
-          }
-          list_num.push_back(*sub_iter);
-        }
-        ++size;
+        overflow = true;
       }
+      std::cout << (first ? "" : " ") << value;
+      first = false;
     }
-    list_sums.push_back(sum);
-    list_nums.push_back(list_num);
-  }
-
-  outputList(std::cout, list_names);
-  std::cout << '\n';
-  for (auto iter_nums = list_nums.begin(); iter_nums != list_nums.end(); ++iter_nums)
-  {
-    outputList(std::cout, *iter_nums);
     std::cout << '\n';
+    list_sums.push_back(sum);
   }
   if (overflow)
   {
@@ -3,52 +3,102 @@
 #include <limits>
 #include "stack.hpp"
 
-bool isAdditionOverflow(long long num1, long long num2)
+namespace
 {
-  const long long max = std::numeric_limits< long long >::max();
-  const long long min = std::numeric_limits< long long >::min();
-  if (num1 > 0 && num2 > 0 && (max - num1 < num2))
+  using operation_t = long long (*)(long long, long long);
+
+  long long add(long long num1, long long num2)
   {
-    return true;
+    long long res = 0;
+    if (__builtin_add_overflow(num1, num2, &res))
+    {
+      throw std::logic_error("Overflow during addition");
+    }
+    return res;
   }
-  if (num1 < 0 && num2 < 0 && (min - num1 > num2))
+
+  long long subtract(long long num1, long long num2)
   {
-    return true;
+    long long res = 0;
+    if (__builtin_sub_overflow(num1, num2, &res))
+    {
+      throw std::logic_error("Overflow during substraction");
+    }
+    return res;
   }
-  return false;
-}
 
-bool isSubtractionOverflow(long long num1, long long num2)
-{
-  return isAdditionOverflow(num1, - num2);
-}
+  long long multiply(long long num1, long long num2)
+  {
+    long long res = 0;
+    if (__builtin_mul_overflow(num1, num2, &res))
+    {
+      throw std::logic_error("Overflow during multiplication");
+    }
+    return res;
+  }
 
-bool isMultiplicationOverflow(long long num1, long long num2)
-{
-  if (num1 == 0 || num2 == 0)
+  long long divide(long long num1, long long num2)
   {
-    return false;
+    if (num2 == 0)
+    {
+      throw std::logic_error("Division by zero");
+    }
+    if (num2 == -1 && num1 == std::numeric_limits< long long >::min())
+    {
+      throw std::logic_error("Overflow during division");
+    }
+    return num1 / num2;
   }
-  const long long max = std::numeric_limits< long long >::max();
-  if (std::abs(num1) > max / std::abs(num2))
+
+  long long remainder(long long num1, long long num2)
   {
-    return true;
+    if (num2 == 0)
+    {
+      throw std::logic_error("Division by zero");
+    }
+    long long res = (num2 == -1) ? 0 : num1 % num2;
+    if (num1 < 0)
+    {
+      bool is_overflow = (num2 < 0) ? __builtin_sub_overflow(res, num2, &res) : __builtin_add_overflow(res, num2, &res);
+      if (is_overflow)
+      {
+        throw std::logic_error("Overflow during division");
+      }
+    }
+    return res;
   }
-  return false;
+
+  const operation_t operations[] = {
+    remainder, nullptr, nullptr, nullptr, nullptr, multiply, add, nullptr, subtract, nullptr, divide
+  };
+  const size_t operations_count = sizeof(operations) / sizeof(operations[0]);
 }
 
-long long lopatina::calculatePostfix(Queue< PostfixType > & queue_postfix)
+long long lopatina::applyOperation(char operation, long long num1, long long num2)
 {
-  Stack< long long > stack_process;
+  size_t index = static_cast< unsigned char >(operation - '%');
+  if (index >= operations_count || operations[index] == nullptr)
+  {
+    throw std::logic_error("Wrong math expression");
+  }
+  return operations[index](num1, num2);
+}
 
-  while (!queue_postfix.empty())
+long long lopatina::calculatePostfix(const PostfixBuffer & postfix, size_t first, size_t last, operands_t & stack_process)
+{
+  while (!stack_process.empty())
   {
-    PostfixType elem = queue_postfix.front();
-    if (elem.getType() == OPERAND)
+    stack_process.pop();
+  }
+  const TypeName * types = postfix.types();
+  const long long * values = postfix.values();
+  for (size_t i = first; i < last; ++i)
+  {
+    if (types[i] == OPERAND)
     {
-      stack_process.push(elem.getOperand());
+      stack_process.push(values[i]);
     }
-    else if (elem.getType() == OPERATION)
+    else if (types[i] == OPERATION)
     {
       if (stack_process.empty())
       {
@@ -62,54 +112,12 @@ long long lopatina::calculatePostfix(Queue< PostfixType > & queue_postfix)
       }
       long long num1 = stack_process.top();
       stack_process.pop();
-      char operation = elem.getOperation();
-      if (operation == '+')
-      {
-        if (isAdditionOverflow(num1, num2))
-        {
-          throw std::logic_error("Overflow during addition");
-        }
-        stack_process.push(num1 + num2);
-      }
-      else if (operation == '-')
-      {
-        if (isSubtractionOverflow(num1, num2))
-        {
-          throw std::logic_error("Overflow during substraction");
-        }
-        stack_process.push(num1 - num2);
-      }
-      else if (operation == '*')
-      {
-        if (isMultiplicationOverflow(num1, num2))
-        {
-          throw std::logic_error("Overflow during multiplication");
-        }
-        stack_process.push(num1 * num2);
-      }
-      else if (operation == '/')
-      {
-        if (num2 == 0)
-        {
-          throw std::logic_error("Division by zero");
-        }
-        stack_process.push(num1 / num2);
-      }
-      else if (operation == '%')
-      {
-        if (num2 == 0)
-        {
-          throw std::logic_error("Division by zero");
-        }
-        long long res = num1 % num2;
-        if (num1 < 0)
-        {
-          res = std::abs(num2) + res;
-        }
-        stack_process.push(res);
-      }
+      stack_process.push(applyOperation(static_cast< char >(values[i]), num1, num2));
     }
-    queue_postfix.pop();
+  }
+  if (stack_process.empty())
+  {
+    throw std::logic_error("Wrong math expression");
   }
   return stack_process.top();
 }
@@ -1,12 +1,16 @@
 #ifndef CALCULATE_POSTFIX_HPP
 #define CALCULATE_POSTFIX_HPP
 
-#include "queue.hpp"
-#include "types.hpp"
+#include <cstddef>
+#include "stack.hpp"
+#include "postfix_buffer.hpp"
 
 namespace lopatina
 {
-  long long calculatePostfix(Queue< PostfixType > & queue_postfix);
+  using operands_t = Stack< long long, RingBuffer< long long > >;
+
+  long long applyOperation(char operation, long long num1, long long num2);
+  long long calculatePostfix(const PostfixBuffer & postfix, size_t first, size_t last, operands_t & stack_process);
 }
 
 #endif
@@ -2,7 +2,7 @@
 #include <stdexcept>
 #include "stack.hpp"
 
-bool isLowerPriority(const lopatina::InfixType & lhs, const lopatina::InfixType & rhs)
+bool lopatina::isLowerPriority(const InfixType & lhs, const InfixType & rhs)
 {
   int priority_lhs = 1, priority_rhs = 1;
   char symbol_lhs = lhs.getSymbol();
@@ -18,76 +18,70 @@ bool isLowerPriority(const lopatina::InfixType & lhs, const lopatina::InfixType
   return priority_lhs < priority_rhs;
 }
 
-lopatina::Queue< lopatina::PostfixType > lopatina::convertToPostfix(Queue< InfixType > & queue_source)
-{
-  Queue< PostfixType > queue_result;
-  Stack< InfixType > stack_process;
+lopatina::PostfixCompiler::PostfixCompiler(PostfixBuffer & output):
+  output_(output),
+  stack_process_()
+{}
 
-  while (!queue_source.empty())
+void lopatina::PostfixCompiler::push(const InfixType & infix_elem)
+{
+  if (infix_elem.getType() == OPEN_BRACKET)
+  {
+    stack_process_.push(infix_elem);
+  }
+  else if (infix_elem.getType() == OPERAND)
   {
-    InfixType infix_elem = queue_source.front();
-    if (infix_elem.getType() == OPEN_BRACKET)
+    PostfixType postfix_elem{infix_elem.getNumber()};
+    output_.push(postfix_elem);
+  }
+  else if (infix_elem.getType() == CLOSE_BRACKET)
+  {
+    while (!stack_process_.empty() && stack_process_.top().getType() != OPEN_BRACKET)
     {
-      stack_process.push(infix_elem);
+      PostfixType postfix_elem{stack_process_.top().getSymbol()};
+      output_.push(postfix_elem);
+      stack_process_.pop();
     }
-    else if (infix_elem.getType() == OPERAND)
+    if (stack_process_.empty())
     {
-      PostfixType postfix_elem{infix_elem.getNumber()};
-      queue_result.push(postfix_elem);
+      throw std::logic_error("Wrong math expression");
     }
-    else if (infix_elem.getType() == CLOSE_BRACKET)
+    stack_process_.pop();
+  }
+  else if (infix_elem.getType() == OPERATION)
+  {
+    while (!stack_process_.empty())
     {
-      if (stack_process.empty())
-      {
-        throw std::logic_error("Wrong math expression");
-      }
-      InfixType elem_stack = stack_process.top();
-      while (elem_stack.getType() != OPEN_BRACKET)
+      InfixType elem_stack = stack_process_.top();
+      if (elem_stack.getType() == OPERATION && !isLowerPriority(elem_stack, infix_elem))
       {
-        if (stack_process.empty())
-        {
-          throw std::logic_error("Wrong math expression");
-        }
         PostfixType postfix_elem{elem_stack.getSymbol()};
-        queue_result.push(postfix_elem);
-        stack_process.pop();
-        elem_stack = stack_process.top();
+        output_.push(postfix_elem);
+        stack_process_.pop();
       }
-      stack_process.pop();
-    }
-    else if (infix_elem.getType() == OPERATION)
-    {
-      while (!stack_process.empty())
+      else
       {
-        InfixType elem_stack = stack_process.top();
-        if (elem_stack.getType() == OPERATION && !isLowerPriority(elem_stack, infix_elem))
-        {
-          PostfixType postfix_elem{elem_stack.getSymbol()};
-          queue_result.push(postfix_elem);
-          stack_process.pop();
-        }
-        else
-        {
-          break;
-        }
+        break;
       }
-      stack_process.push(infix_elem);
     }
-    queue_source.pop();
+    stack_process_.push(infix_elem);
   }
-  while (!stack_process.empty())
+}
+
+void lopatina::PostfixCompiler::finish()
+{
+  while (!stack_process_.empty())
   {
-    InfixType elem_stack = stack_process.top();
+    InfixType elem_stack = stack_process_.top();
     if (elem_stack.getType() == OPERATION)
     {
       PostfixType postfix_elem{elem_stack.getSymbol()};
-      queue_result.push(postfix_elem);
-      stack_process.pop();
+      output_.push(postfix_elem);
+      stack_process_.pop();
     }
     else
     {
       throw std::logic_error("Wrong math expression");
     }
   }
-  return queue_result;
 }
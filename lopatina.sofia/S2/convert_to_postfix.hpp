@@ -1,12 +1,24 @@
 #ifndef CONVERT_TO_POSTFIX_HPP
 #define CONVERT_TO_POSTFIX_HPP
 
-#include "queue.hpp"
+#include "stack.hpp"
 #include "types.hpp"
+#include "postfix_buffer.hpp"
 
 namespace lopatina
 {
-  Queue< PostfixType > convertToPostfix(Queue< InfixType > & queue_source);
+  bool isLowerPriority(const InfixType & lhs, const InfixType & rhs);
+
+  class PostfixCompiler
+  {
+  public:
+    explicit PostfixCompiler(PostfixBuffer & output);
+    void push(const InfixType & infix_elem);
+    void finish();
+  private:
+    PostfixBuffer & output_;
+    Stack< InfixType, RingBuffer< InfixType > > stack_process_;
+  };
 }
 
 #endif
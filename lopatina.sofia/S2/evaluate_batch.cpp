@@ -0,0 +1,100 @@
+#include "evaluate_batch.hpp"
+#include "types.hpp"
+#include "input_expression.hpp"
+#include "convert_to_postfix.hpp"
+
+bool lopatina::ExpressionBatch::read(std::istream & in)
+{
+  ExpressionReader reader(in);
+  PostfixCompiler compiler(code_);
+  bool has_tokens = false;
+  InfixType elem;
+  std::exception_ptr error;
+  try
+  {
+    while (reader.next(elem))
+    {
+      has_tokens = true;
+      if (!error)
+      {
+        try
+        {
+          compiler.push(elem);
+        }
+        catch (...)
+        {
+          error = std::current_exception();
+        }
+      }
+    }
+    if (!error)
+    {
+      compiler.finish();
+    }
+  }
+  catch (...)
+  {
+    error = std::current_exception();
+  }
+  if (error)
+  {
+    error_ = error;
+    return false;
+  }
+  if (!has_tokens)
+  {
+    return false;
+  }
+  ends_.push_back(code_.size());
+  return true;
+}
+
+size_t lopatina::ExpressionBatch::size() const noexcept
+{
+  return ends_.size();
+}
+
+bool lopatina::ExpressionBatch::failed() const noexcept
+{
+  return static_cast< bool >(error_);
+}
+
+void lopatina::ExpressionBatch::evaluate(Stack< long long, RingBuffer< long long > > & results)
+{
+  size_t begin = 0;
+  while (!ends_.empty())
+  {
+    size_t end = ends_.front();
+    ends_.pop_front();
+    results.push(calculatePostfix(code_, begin, end, operands_));
+    begin = end;
+  }
+  code_.clear();
+  if (error_)
+  {
+    std::exception_ptr error = error_;
+    error_ = nullptr;
+    std::rethrow_exception(error);
+  }
+}
+
+void lopatina::ExpressionBatch::clear() noexcept
+{
+  code_.clear();
+  ends_.clear();
+  error_ = nullptr;
+}
+
+void lopatina::evaluateBatch(std::istream & in, Stack< long long, RingBuffer< long long > > & results)
+{
+  constexpr size_t batch_size = 4096;
+  ExpressionBatch batch;
+  while (!in.eof())
+  {
+    while (!in.eof() && !batch.failed() && batch.size() < batch_size)
+    {
+      batch.read(in);
+    }
+    batch.evaluate(results);
+  }
+}
@@ -0,0 +1,32 @@
+#ifndef EVALUATE_BATCH_HPP
+#define EVALUATE_BATCH_HPP
+
+#include <cstddef>
+#include <exception>
+#include <iostream>
+#include <ring_buffer.hpp>
+#include "stack.hpp"
+#include "postfix_buffer.hpp"
+#include "calculate_postfix.hpp"
+
+namespace lopatina
+{
+  class ExpressionBatch
+  {
+  public:
+    bool read(std::istream & in);
+    size_t size() const noexcept;
+    bool failed() const noexcept;
+    void evaluate(Stack< long long, RingBuffer< long long > > & results);
+    void clear() noexcept;
+  private:
+    PostfixBuffer code_;
+    RingBuffer< size_t > ends_;
+    operands_t operands_;
+    std::exception_ptr error_;
+  };
+
+  void evaluateBatch(std::istream & in, Stack< long long, RingBuffer< long long > > & results);
+}
+
+#endif
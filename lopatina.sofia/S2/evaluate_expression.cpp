@@ -0,0 +1,118 @@
+#include "evaluate_expression.hpp"
+#include <exception>
+#include <stdexcept>
+#include "stack.hpp"
+#include "types.hpp"
+#include "input_expression.hpp"
+#include "convert_to_postfix.hpp"
+#include "calculate_postfix.hpp"
+
+namespace
+{
+  using operations_t = lopatina::Stack< lopatina::InfixType, lopatina::RingBuffer< lopatina::InfixType > >;
+
+  void applyTop(lopatina::operands_t & operands, operations_t & operations, std::exception_ptr & error)
+  {
+    char operation = operations.top().getSymbol();
+    operations.pop();
+    if (error)
+    {
+      return;
+    }
+    try
+    {
+      if (operands.empty())
+      {
+        throw std::logic_error("Wrong math expression");
+      }
+      long long num2 = operands.top();
+      operands.pop();
+      if (operands.empty())
+      {
+        throw std::logic_error("Wrong math expression");
+      }
+      long long num1 = operands.top();
+      operands.pop();
+      operands.push(lopatina::applyOperation(operation, num1, num2));
+    }
+    catch (...)
+    {
+      error = std::current_exception();
+    }
+  }
+}
+
+bool lopatina::evaluateExpression(std::istream & in, long long & result)
+{
+  ExpressionReader reader(in);
+  operands_t operands;
+  operations_t operations;
+  bool has_tokens = false;
+  bool is_balanced = true;
+  std::exception_ptr error;
+
+  InfixType elem;
+  while (reader.next(elem))
+  {
+    has_tokens = true;
+    if (!is_balanced)
+    {
+      continue;
+    }
+    if (elem.getType() == OPEN_BRACKET)
+    {
+      operations.push(elem);
+    }
+    else if (elem.getType() == OPERAND)
+    {
+      operands.push(elem.getNumber());
+    }
+    else if (elem.getType() == CLOSE_BRACKET)
+    {
+      while (!operations.empty() && operations.top().getType() != OPEN_BRACKET)
+      {
+        applyTop(operands, operations, error);
+      }
+      if (operations.empty())
+      {
+        is_balanced = false;
+        continue;
+      }
+      operations.pop();
+    }
+    else if (elem.getType() == OPERATION)
+    {
+      while (!operations.empty() && operations.top().getType() == OPERATION && !isLowerPriority(operations.top(), elem))
+      {
+        applyTop(operands, operations, error);
+      }
+      operations.push(elem);
+    }
+  }
+  if (!has_tokens)
+  {
+    return false;
+  }
+  while (is_balanced && !operations.empty())
+  {
+    is_balanced = (operations.top().getType() == OPERATION);
+    if (is_balanced)
+    {
+      applyTop(operands, operations, error);
+    }
+  }
+  if (!is_balanced)
+  {
+    throw std::logic_error("Wrong math expression");
+  }
+  if (error)
+  {
+    std::rethrow_exception(error);
+  }
+  if (operands.empty())
+  {
+    throw std::logic_error("Wrong math expression");
+  }
+  result = operands.top();
+  return true;
+}
@@ -0,0 +1,11 @@
+#ifndef EVALUATE_EXPRESSION_HPP
+#define EVALUATE_EXPRESSION_HPP
+
+#include <iostream>
+
+namespace lopatina
+{
+  bool evaluateExpression(std::istream & in, long long & result);
+}
+
+#endif
@@ -0,0 +1,72 @@
+#include "evaluate_parallel.hpp"
+#include <future>
+#include <sstream>
+#include <string>
+#include <utility>
+#include "evaluate_expression.hpp"
+
+namespace
+{
+  constexpr size_t chunk_size = 1 << 20;
+
+  bool readChunk(std::istream & in, std::string & chunk)
+  {
+    std::string line;
+    while (chunk.size() < chunk_size && std::getline(in, line))
+    {
+      chunk += line;
+      if (!in.eof())
+      {
+        chunk += '\n';
+      }
+    }
+    return !chunk.empty();
+  }
+
+  lopatina::RingBuffer< long long > evaluateChunk(const std::string & chunk)
+  {
+    lopatina::RingBuffer< long long > results;
+    std::istringstream in(chunk);
+    while (!in.eof())
+    {
+      long long result = 0;
+      if (lopatina::evaluateExpression(in, result))
+      {
+        results.push_back(result);
+      }
+    }
+    return results;
+  }
+
+  void collect(lopatina::RingBuffer< std::future< lopatina::RingBuffer< long long > > > & pending,
+    lopatina::Stack< long long, lopatina::RingBuffer< long long > > & results)
+  {
+    lopatina::RingBuffer< long long > chunk_results = pending.front().get();
+    pending.pop_front();
+    while (!chunk_results.empty())
+    {
+      results.push(chunk_results.front());
+      chunk_results.pop_front();
+    }
+  }
+}
+
+void lopatina::evaluateParallel(std::istream & in, Stack< long long, RingBuffer< long long > > & results, size_t jobs)
+{
+  RingBuffer< std::future< RingBuffer< long long > > > pending;
+  std::string chunk;
+  while (readChunk(in, chunk))
+  {
+    if (pending.size() == jobs)
+    {
+      collect(pending, results);
+    }
+    std::string text;
+    text.swap(chunk);
+    pending.push_back(std::async(std::launch::async, evaluateChunk, std::move(text)));
+  }
+  while (!pending.empty())
+  {
+    collect(pending, results);
+  }
+}
@@ -0,0 +1,14 @@
+#ifndef EVALUATE_PARALLEL_HPP
+#define EVALUATE_PARALLEL_HPP
+
+#include <cstddef>
+#include <iostream>
+#include <ring_buffer.hpp>
+#include "stack.hpp"
+
+namespace lopatina
+{
+  void evaluateParallel(std::istream & in, Stack< long long, RingBuffer< long long > > & results, size_t jobs);
+}
+
+#endif
@@ -1,6 +1,5 @@
 #include "input_expression.hpp"
 #include <stdexcept>
-#include <string>
 
 bool isDigit(char c)
 {
@@ -12,57 +11,91 @@ bool isArithmetic(char c)
   return (c == '+' || c == '-' || c == '*' || c == '/' || c == '%');
 }
 
-void lopatina::inputExpression(std::istream & in, Queue< InfixType > & queue_source)
+lopatina::ExpressionReader::ExpressionReader(std::istream & in):
+  in_(in),
+  number_(0),
+  has_number_(false),
+  overflow_(false),
+  done_(false)
+{}
+
+bool lopatina::ExpressionReader::next(InfixType & elem)
 {
-  char c = 0;
-  std::string num_str = "";
-  in >> std::noskipws;
-  while (in >> c)
+  if (done_)
+  {
+    return false;
+  }
+  using traits = std::istream::traits_type;
+  std::streambuf * buf = in_.rdbuf();
+  traits::int_type ch = 0;
+  while ((ch = buf->sbumpc()) != traits::eof())
   {
+    char c = traits::to_char_type(ch);
     if (c == '\n')
     {
-      if (!num_str.empty())
-      {
-        long long num = std::stoll(num_str);
-        InfixType elem{num, TypeName::OPERAND};
-        queue_source.push(elem);
-      }
-      in >> std::skipws;
-      return;
+      done_ = true;
+      return flushNumber(elem);
     }
     if (isDigit(c))
     {
-      num_str += c;
+      appendDigit(c);
     }
     else if (c == ' ')
     {
-      if (!num_str.empty())
+      if (flushNumber(elem))
       {
-        long long num = std::stoll(num_str);
-        InfixType elem{num, TypeName::OPERAND};
-        queue_source.push(elem);
-        num_str = "";
+        return true;
       }
     }
     else if (c == '(')
     {
-      InfixType elem{c, TypeName::OPEN_BRACKET};
-      queue_source.push(elem);
+      elem = InfixType{c, TypeName::OPEN_BRACKET};
+      return true;
     }
     else if (c == ')')
     {
-      InfixType elem{c, TypeName::CLOSE_BRACKET};
-      queue_source.push(elem);
+      elem = InfixType{c, TypeName::CLOSE_BRACKET};
+      return true;
     }
     else if (isArithmetic(c))
     {
-      InfixType elem{c, TypeName::OPERATION};
-      queue_source.push(elem);
+      elem = InfixType{c, TypeName::OPERATION};
+      return true;
     }
     else
     {
-      in >> std::skipws;
+      done_ = true;
       throw std::invalid_argument("Invalid expression element");
     }
   }
+  done_ = true;
+  in_.setstate(std::ios::eofbit | std::ios::failbit);
+  return false;
+}
+
+void lopatina::ExpressionReader::appendDigit(char c)
+{
+  has_number_ = true;
+  if (overflow_)
+  {
+    return;
+  }
+  long long digit = c - '0';
+  overflow_ = __builtin_mul_overflow(number_, 10, &number_) || __builtin_add_overflow(number_, digit, &number_);
+}
+
+bool lopatina::ExpressionReader::flushNumber(InfixType & elem)
+{
+  if (!has_number_)
+  {
+    return false;
+  }
+  if (overflow_)
+  {
+    throw std::out_of_range("stoll");
+  }
+  elem = InfixType{number_, TypeName::OPERAND};
+  number_ = 0;
+  has_number_ = false;
+  return true;
 }
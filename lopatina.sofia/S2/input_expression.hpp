@@ -2,12 +2,26 @@
 #define INPUT_EXPRESSION_HPP
 
 #include <iostream>
-#include "queue.hpp"
 #include "types.hpp"
 
 namespace lopatina
 {
-  void inputExpression(std::istream & in, Queue< InfixType > & queue_source);
+  class ExpressionReader
+  {
+  public:
+    explicit ExpressionReader(std::istream & in);
+    bool next(InfixType & elem);
+  private:
+    std::istream & in_;
+    long long number_;
+    bool has_number_;
+    bool overflow_;
+    bool done_;
+
+    void appendDigit(char c);
+
+    bool flushNumber(InfixType & elem);
+  };
 }
 
 #endif
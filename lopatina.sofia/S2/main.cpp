@@ -1,54 +1,84 @@
 #include <iostream>
 #include <fstream>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
 #include <stdexcept>
-#include "queue.hpp"
+#include <thread>
 #include "stack.hpp"
-#include "types.hpp"
-#include "input_expression.hpp"
-#include "convert_to_postfix.hpp"
-#include "calculate_postfix.hpp"
+#include "evaluate_expression.hpp"
+#include "evaluate_batch.hpp"
+#include "evaluate_parallel.hpp"
 
 int main(int argc, char ** argv)
 {
   using namespace lopatina;
 
-  Stack< long long > stack_result;
-  Queue< Queue< InfixType > > queue_input;
-  try
+  bool batch = false;
+  size_t jobs = 0;
+  const char * file_name = nullptr;
+  for (int i = 1; i < argc; ++i)
   {
-    if (argc == 1)
+    if (std::strcmp(argv[i], "--batch") == 0)
+    {
+      batch = true;
+    }
+    else if (std::strcmp(argv[i], "--jobs") == 0)
     {
-      while (!std::cin.eof())
+      const char * value = (i + 1 < argc) ? argv[++i] : "";
+      char * end = nullptr;
+      jobs = (*value >= '0' && *value <= '9') ? std::strtoul(value, std::addressof(end), 10) : 0;
+      if (jobs == 0 || *end != '\0')
       {
-        Queue< InfixType > queue_infix;
-        inputExpression(std::cin, queue_infix);
-        queue_input.push(queue_infix);
+        std::cerr << "Invalid jobs count\n";
+        return 1;
       }
+      size_t max_jobs = std::max(std::thread::hardware_concurrency(), 1u);
+      jobs = std::min(jobs, max_jobs);
     }
     else
     {
-      std::ifstream input(argv[1]);
-      if (!input)
+      file_name = argv[i];
+    }
+  }
+  if (batch && jobs != 0)
+  {
+    std::cerr << "--batch and --jobs can't be combined\n";
+    return 1;
+  }
+  Stack< long long, RingBuffer< long long > > stack_result;
+  try
+  {
+    std::ifstream file;
+    if (file_name)
+    {
+      file.open(file_name);
+      if (!file)
       {
         std::cerr << "No such file\n";
         return 1;
       }
-      while (!input.eof())
-      {
-        Queue< InfixType > queue_infix;
-        inputExpression(input, queue_infix);
-        queue_input.push(queue_infix);
-      }
     }
-    while (!queue_input.empty())
+    std::istream & input = file_name ? file : std::cin;
+    if (jobs != 0)
+    {
+      evaluateParallel(input, stack_result, jobs);
+    }
+    else if (batch)
     {
-      Queue< InfixType > queue_infix = queue_input.front();
-      if (!queue_infix.empty())
+      evaluateBatch(input, stack_result);
+    }
+    else
+    {
+      while (!input.eof())
       {
-        Queue< PostfixType > queue_postfix = convertToPostfix(queue_infix);
-        stack_result.push(calculatePostfix(queue_postfix));
+        long long result = 0;
+        if (evaluateExpression(input, result))
+        {
+          stack_result.push(result);
+        }
       }
-      queue_input.pop();
     }
   }
   catch (const std::exception & e)
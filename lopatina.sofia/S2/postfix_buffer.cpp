@@ -0,0 +1,137 @@
+#include "postfix_buffer.hpp"
+#include <algorithm>
+#include <memory>
+#include <utility>
+
+lopatina::PostfixBuffer::PostfixBuffer():
+  types_(nullptr),
+  values_(nullptr),
+  size_(0),
+  capacity_(0)
+{}
+
+lopatina::PostfixBuffer::PostfixBuffer(const PostfixBuffer & other):
+  PostfixBuffer()
+{
+  reserve(other.size_);
+  std::copy(other.types_, other.types_ + other.size_, types_);
+  std::copy(other.values_, other.values_ + other.size_, values_);
+  size_ = other.size_;
+}
+
+lopatina::PostfixBuffer::PostfixBuffer(PostfixBuffer && other) noexcept:
+  types_(other.types_),
+  values_(other.values_),
+  size_(other.size_),
+  capacity_(other.capacity_)
+{
+  other.types_ = nullptr;
+  other.values_ = nullptr;
+  other.size_ = 0;
+  other.capacity_ = 0;
+}
+
+lopatina::PostfixBuffer::~PostfixBuffer()
+{
+  delete [] types_;
+  delete [] values_;
+}
+
+lopatina::PostfixBuffer & lopatina::PostfixBuffer::operator=(const PostfixBuffer & other)
+{
+  if (this != std::addressof(other))
+  {
+    PostfixBuffer copy{other};
+    swap(copy);
+  }
+  return *this;
+}
+
+lopatina::PostfixBuffer & lopatina::PostfixBuffer::operator=(PostfixBuffer && other) noexcept
+{
+  if (this != std::addressof(other))
+  {
+    PostfixBuffer temp{std::move(other)};
+    swap(temp);
+  }
+  return *this;
+}
+
+bool lopatina::PostfixBuffer::empty() const noexcept
+{
+  return size_ == 0;
+}
+
+size_t lopatina::PostfixBuffer::size() const noexcept
+{
+  return size_;
+}
+
+const lopatina::TypeName * lopatina::PostfixBuffer::types() const noexcept
+{
+  return types_;
+}
+
+const long long * lopatina::PostfixBuffer::values() const noexcept
+{
+  return values_;
+}
+
+lopatina::PostfixType lopatina::PostfixBuffer::operator[](size_t pos) const
+{
+  if (types_[pos] == OPERAND)
+  {
+    return PostfixType{values_[pos]};
+  }
+  return PostfixType{static_cast< char >(values_[pos])};
+}
+
+void lopatina::PostfixBuffer::push(const PostfixType & elem)
+{
+  if (size_ == capacity_)
+  {
+    reserve((capacity_ == 0) ? 16 : capacity_ * 2);
+  }
+  types_[size_] = elem.getType();
+  values_[size_] = (elem.getType() == OPERAND) ? elem.getOperand() : elem.getOperation();
+  ++size_;
+}
+
+void lopatina::PostfixBuffer::reserve(size_t capacity)
+{
+  if (capacity <= capacity_)
+  {
+    return;
+  }
+  TypeName * new_types = new TypeName[capacity];
+  long long * new_values = nullptr;
+  try
+  {
+    new_values = new long long[capacity];
+  }
+  catch (...)
+  {
+    delete [] new_types;
+    throw;
+  }
+  std::copy(types_, types_ + size_, new_types);
+  std::copy(values_, values_ + size_, new_values);
+  delete [] types_;
+  delete [] values_;
+  types_ = new_types;
+  values_ = new_values;
+  capacity_ = capacity;
+}
+
+void lopatina::PostfixBuffer::clear() noexcept
+{
+  size_ = 0;
+}
+
+void lopatina::PostfixBuffer::swap(PostfixBuffer & other) noexcept
+{
+  std::swap(types_, other.types_);
+  std::swap(values_, other.values_);
+  std::swap(size_, other.size_);
+  std::swap(capacity_, other.capacity_);
+}
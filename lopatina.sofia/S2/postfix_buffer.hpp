@@ -0,0 +1,38 @@
+#ifndef POSTFIX_BUFFER_HPP
+#define POSTFIX_BUFFER_HPP
+
+#include <cstddef>
+#include "types.hpp"
+
+namespace lopatina
+{
+  class PostfixBuffer
+  {
+  public:
+    PostfixBuffer();
+    PostfixBuffer(const PostfixBuffer & other);
+    PostfixBuffer(PostfixBuffer && other) noexcept;
+    ~PostfixBuffer();
+
+    PostfixBuffer & operator=(const PostfixBuffer & other);
+    PostfixBuffer & operator=(PostfixBuffer && other) noexcept;
+
+    bool empty() const noexcept;
+    size_t size() const noexcept;
+    const TypeName * types() const noexcept;
+    const long long * values() const noexcept;
+    PostfixType operator[](size_t pos) const;
+    void push(const PostfixType & elem);
+    void reserve(size_t capacity);
+    void clear() noexcept;
+    void swap(PostfixBuffer & other) noexcept;
+
+  private:
+    TypeName * types_;
+    long long * values_;
+    size_t size_;
+    size_t capacity_;
+  };
+}
+
+#endif
@@ -2,10 +2,12 @@
 #define STACK_HPP
 
 #include <list.hpp>
+#include <node_pool.hpp>
+#include <ring_buffer.hpp>
 
 namespace lopatina
 {
-  template < typename T >
+  template < typename T, typename Container = List< T, PoolAllocator< T >, DoublyLinked > >
   class Stack
   {
   public:
@@ -34,7 +36,7 @@ namespace lopatina
       stack_list.pop_back();
     }
   private:
-    List< T > stack_list;
+    Container stack_list;
   };
 }
 
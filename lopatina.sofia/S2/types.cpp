@@ -2,11 +2,9 @@
 
 lopatina::InfixType::InfixType(long long val, TypeName name):
   number_(val),
-  symbol_(0),
   type_(name)
 {}
 lopatina::InfixType::InfixType(char val, TypeName name):
-  number_(0),
   symbol_(val),
   type_(name)
 {}
@@ -26,11 +24,9 @@ char lopatina::InfixType::getSymbol() const
 
 lopatina::PostfixType::PostfixType(long long val):
   operand_(val),
-  operation_(0),
   type_(TypeName::OPERAND)
 {}
 lopatina::PostfixType::PostfixType(char val):
-  operand_(0),
   operation_(val),
   type_(TypeName::OPERATION)
 {}
@@ -3,7 +3,7 @@
 
 namespace lopatina
 {
-  enum TypeName
+  enum TypeName: unsigned char
   {
     OPERAND,
     OPERATION,
@@ -22,8 +22,11 @@ namespace lopatina
     long long getNumber() const;
     char getSymbol() const;
   private:
-    long long number_;
-    char symbol_;
+    union
+    {
+      long long number_;
+      char symbol_;
+    };
     TypeName type_;
   };
 
@@ -38,8 +41,11 @@ namespace lopatina
     long long getOperand() const;
     char getOperation() const;
   private:
-    long long operand_;
-    char operation_;
+    union
+    {
+      long long operand_;
+      char operation_;
+    };
     TypeName type_;
   };
 }
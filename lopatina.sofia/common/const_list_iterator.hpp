@@ -1,38 +1,47 @@
-#ifndef ITERATOR_HPP
-#define ITERATOR_HPP
+#ifndef CONST_LIST_ITERATOR_HPP
+#define CONST_LIST_ITERATOR_HPP
 
 #include <iterator>
-#include <forward_list>
+#include <memory>
+#include <type_traits>
 #include <cassert>
 #include "node.hpp"
 
 namespace lopatina
 {
-  template < typename T >
+  template < typename T, typename Alloc, typename Links >
   class List;
 
-  template < typename T >
+  template < typename T, typename Links >
   struct ListIterator;
 
-  template < typename T >
-  struct ConstListIterator: public std::iterator< std::forward_iterator_tag, T >
+  template < typename T, typename Links = SinglyLinked >
+  struct ConstListIterator: public std::iterator<
+    typename std::conditional< std::is_same< Links, DoublyLinked >::value, std::bidirectional_iterator_tag, std::forward_iterator_tag >::type,
+    T
+  >
   {
-    friend class List< T >;
-    friend struct ListIterator< T >;
+    template < typename, typename, typename >
+    friend class List;
+    friend struct ListIterator< T, Links >;
 
   public:
-    using this_t = ConstListIterator< T >;
+    using this_t = ConstListIterator< T, Links >;
+    using node_t = Node< T, Links >;
     ConstListIterator():
-      node_(nullptr)
+      node_(nullptr),
+      tail_(nullptr)
     {}
-    ConstListIterator(Node< T > * node):
-      node_(node)
+    ConstListIterator(node_t * node, node_t * const * tail = nullptr):
+      node_(node),
+      tail_(tail)
     {}
     ~ConstListIterator() = default;
 
     ConstListIterator(const this_t &) = default;
-    ConstListIterator(const ListIterator< T > & other):
-      node_(other.node_)
+    ConstListIterator(const ListIterator< T, Links > & other):
+      node_(other.node_),
+      tail_(other.tail_)
     {}
     this_t & operator=(const this_t &) = default;
     this_t & operator++()
@@ -48,6 +57,26 @@ namespace lopatina
       ++(*this);
       return result;
     }
+    this_t & operator--()
+    {
+      static_assert(std::is_same< Links, DoublyLinked >::value, "Decrement requires a doubly linked list");
+      if (node_ == nullptr)
+      {
+        assert(tail_ != nullptr);
+        node_ = *tail_;
+      }
+      else
+      {
+        node_ = node_->prev_;
+      }
+      return *this;
+    }
+    this_t operator--(int)
+    {
+      this_t result(*this);
+      --(*this);
+      return result;
+    }
     const T & operator*() const
     {
       assert(node_ != nullptr);
@@ -69,7 +98,8 @@ namespace lopatina
     }
 
   private:
-    Node< T > * node_;
+    node_t * node_;
+    node_t * const * tail_;
   };
 }
 
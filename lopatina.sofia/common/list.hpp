@@ -2,21 +2,26 @@
 #define LIST_HPP
 
 #include <cstddef>
+#include <iterator>
+#include <memory>
+#include <utility>
 #include "node.hpp"
 #include "list_iterator.hpp"
 #include "const_list_iterator.hpp"
 
 namespace lopatina
 {
-  template < typename T >
+  template < typename T, typename Alloc = std::allocator< T >, typename Links = SinglyLinked >
   class List
   {
-    friend struct ListIterator< T >;
-    friend struct ConstListIterator< T >;
+    friend struct ListIterator< T, Links >;
+    friend struct ConstListIterator< T, Links >;
 
   public:
-    using iterator = ListIterator< T >;
-    using const_iterator = ConstListIterator< T >;
+    using iterator = ListIterator< T, Links >;
+    using const_iterator = ConstListIterator< T, Links >;
+    using reverse_iterator = std::reverse_iterator< iterator >;
+    using const_reverse_iterator = std::reverse_iterator< const_iterator >;
 
     List();
     List(const List & other);
@@ -37,6 +42,10 @@ namespace lopatina
     const_iterator end() const noexcept;
     const_iterator cbegin() const noexcept;
     const_iterator cend() const noexcept;
+    reverse_iterator rbegin() noexcept;
+    reverse_iterator rend() noexcept;
+    const_reverse_iterator crbegin() const noexcept;
+    const_reverse_iterator crend() const noexcept;
 
     T & front();
     const T & front() const;
@@ -68,35 +77,48 @@ namespace lopatina
     iterator insert_after(const_iterator position, InputIterator first, InputIterator last);
     iterator insert_after(const_iterator position, std::initializer_list< T > init_list);
 
-    void splice_after(const_iterator position, List< T > & fwdlst);
-    void splice_after(const_iterator position, List< T > && fwdlst);
-    void splice_after(const_iterator position, List< T > & fwdlst, const_iterator it);
-    void splice_after(const_iterator position, List< T > && fwdlst, const_iterator it);
-    void splice_after(const_iterator position, List< T > & fwdlst, const_iterator first, const_iterator last);
-    void splice_after(const_iterator position, List< T > && fwdlst, const_iterator first, const_iterator last);
+    void splice_after(const_iterator position, List & fwdlst);
+    void splice_after(const_iterator position, List && fwdlst);
+    void splice_after(const_iterator position, List & fwdlst, const_iterator it);
+    void splice_after(const_iterator position, List && fwdlst, const_iterator it);
+    void splice_after(const_iterator position, List & fwdlst, const_iterator first, const_iterator last);
+    void splice_after(const_iterator position, List && fwdlst, const_iterator first, const_iterator last);
 
     T & back();
     const T & back() const;
     void pop_back();
 
   private:
-    Node< T > * head_;
-    Node< T > * tail_;
-
-    Node< T > * remove_node(Node< T > * prev, Node< T > * todelete);
+    using node_allocator = typename std::allocator_traits< Alloc >::template rebind_alloc< Node< T, Links > >;
+    using node_traits = std::allocator_traits< node_allocator >;
+
+    Node< T, Links > * head_;
+    Node< T, Links > * tail_;
+    node_allocator alloc_;
+
+    template < typename... Args >
+    Node< T, Links > * create_node(Args &&... args);
+    iterator link_after(const_iterator position, Node< T, Links > * new_node);
+    void destroy_node(Node< T, Links > * node) noexcept;
+    Node< T, Links > * remove_node(Node< T, Links > * prev, Node< T, Links > * todelete);
+    Node< T, Links > * prev_node(Node< T, Links > * node, SinglyLinked) const noexcept;
+    Node< T, Links > * prev_node(Node< T, Links > * node, DoublyLinked) const noexcept;
   };
 
-  template < typename T >
-  List< T >::List():
+  template < typename T, typename Alloc, typename Links >
+  List< T, Alloc, Links >::List():
     head_(nullptr),
-    tail_(nullptr)
+    tail_(nullptr),
+    alloc_()
   {}
 
-  template < typename T >
-  List< T >::List(const List & other):
-    List()
+  template < typename T, typename Alloc, typename Links >
+  List< T, Alloc, Links >::List(const List & other):
+    head_(nullptr),
+    tail_(nullptr),
+    alloc_(node_traits::select_on_container_copy_construction(other.alloc_))
   {
-    Node< T > * newnode = other.head_;
+    Node< T, Links > * newnode = other.head_;
     while (newnode)
     {
       push_back(newnode->data_);
@@ -104,22 +126,23 @@ namespace lopatina
     }
   }
 
-  template < typename T >
-  List< T >::List(List && other) noexcept:
+  template < typename T, typename Alloc, typename Links >
+  List< T, Alloc, Links >::List(List && other) noexcept:
     head_(other.head_),
-    tail_(other.tail_)
+    tail_(other.tail_),
+    alloc_(std::move(other.alloc_))
   {
     other.head_ = nullptr;
     other.tail_ = nullptr;
   }
 
-  template < typename T >
-  List< T >::List(size_t n):
+  template < typename T, typename Alloc, typename Links >
+  List< T, Alloc, Links >::List(size_t n):
     List(n, T())
   {}
 
-  template < typename T >
-  List< T >::List(size_t n, const T & val):
+  template < typename T, typename Alloc, typename Links >
+  List< T, Alloc, Links >::List(size_t n, const T & val):
     List()
   {
     for (size_t i = 0; i < n; ++i)
@@ -128,9 +151,9 @@ namespace lopatina
     }
   }
 
-  template < typename T >
+  template < typename T, typename Alloc, typename Links >
   template < typename InputIterator >
-  List< T >::List(InputIterator first, InputIterator last):
+  List< T, Alloc, Links >::List(InputIterator first, InputIterator last):
     List()
   {
     for (auto it = first; it != last; ++it)
@@ -139,8 +162,8 @@ namespace lopatina
     }
   }
 
-  template < typename T >
-  List< T >::List(std::initializer_list< T > init_list):
+  template < typename T, typename Alloc, typename Links >
+  List< T, Alloc, Links >::List(std::initializer_list< T > init_list):
     List()
   {
     for (auto it = init_list.begin(); it != init_list.end(); ++it)
@@ -149,25 +172,25 @@ namespace lopatina
     }
   }
 
-  template < typename T >
-  List< T >::~List()
+  template < typename T, typename Alloc, typename Links >
+  List< T, Alloc, Links >::~List()
   {
     clear();
   }
 
-  template < typename T >
-  List< T > & List< T >::operator=(const List & other)
+  template < typename T, typename Alloc, typename Links >
+  List< T, Alloc, Links > & List< T, Alloc, Links >::operator=(const List & other)
   {
     if (this != std::addressof(other))
     {
-      List< T > copy{other};
+      List copy{other};
       swap(copy);
     }
     return *this;
   }
 
-  template < typename T >
-  List< T > & List< T >::operator=(List && other) noexcept
+  template < typename T, typename Alloc, typename Links >
+  List< T, Alloc, Links > & List< T, Alloc, Links >::operator=(List && other) noexcept
   {
     if (this != std::addressof(other))
     {
@@ -176,33 +199,35 @@ namespace lopatina
       tail_ = other.tail_;
       other.head_ = nullptr;
       other.tail_ = nullptr;
+      std::swap(alloc_, other.alloc_);
     }
     return *this;
   }
 
-  template < typename T >
-  T & List< T >::front()
+  template < typename T, typename Alloc, typename Links >
+  T & List< T, Alloc, Links >::front()
   {
     return head_->data_;
   }
 
-  template < typename T >
-  const T & List< T >::front() const
+  template < typename T, typename Alloc, typename Links >
+  const T & List< T, Alloc, Links >::front() const
   {
     return head_->data_;
   }
 
-  template < typename T >
-  bool List< T >::empty() const noexcept
+  template < typename T, typename Alloc, typename Links >
+  bool List< T, Alloc, Links >::empty() const noexcept
   {
     return head_ == nullptr;
   }
 
-  template < typename T >
-  void List< T >::push_front(const T & val)
+  template < typename T, typename Alloc, typename Links >
+  void List< T, Alloc, Links >::push_front(const T & val)
   {
-    Node< T > * newnode = new Node< T >(val);
+    Node< T, Links > * newnode = create_node(val);
     newnode->next_ = head_;
+    setPrev(head_, newnode);
     head_ = newnode;
     if (tail_ == nullptr)
     {
@@ -210,11 +235,12 @@ namespace lopatina
     }
   }
 
-  template < typename T >
-  void List< T >::push_front(T && val)
+  template < typename T, typename Alloc, typename Links >
+  void List< T, Alloc, Links >::push_front(T && val)
   {
-    Node< T > * newnode = new Node< T >(std::move(val));
+    Node< T, Links > * newnode = create_node(std::move(val));
     newnode->next_ = head_;
+    setPrev(head_, newnode);
     head_ = newnode;
     if (tail_ == nullptr)
     {
@@ -222,10 +248,10 @@ namespace lopatina
     }
   }
 
-  template < typename T >
-  void List< T >::push_back(const T & val)
+  template < typename T, typename Alloc, typename Links >
+  void List< T, Alloc, Links >::push_back(const T & val)
   {
-    Node< T > * newnode = new Node< T >(val);
+    Node< T, Links > * newnode = create_node(val);
     if (empty())
     {
       head_ = newnode;
@@ -233,11 +259,12 @@ namespace lopatina
       return;
     }
     tail_->next_ = newnode;
+    setPrev(newnode, tail_);
     tail_ = newnode;
   }
 
-  template < typename T >
-  void List< T >::pop_front()
+  template < typename T, typename Alloc, typename Links >
+  void List< T, Alloc, Links >::pop_front()
   {
     if (head_ == nullptr)
     {
@@ -245,18 +272,19 @@ namespace lopatina
     }
     if (head_ == tail_)
     {
-      delete head_;
+      destroy_node(head_);
       head_ = nullptr;
       tail_ = nullptr;
       return;
     }
-    Node< T > * newhead = head_->next_;
-    delete head_;
+    Node< T, Links > * newhead = head_->next_;
+    destroy_node(head_);
+    setPrev(newhead, static_cast< Node< T, Links > * >(nullptr));
     head_ = newhead;
   }
 
-  template < typename T >
-  void List< T >::clear() noexcept
+  template < typename T, typename Alloc, typename Links >
+  void List< T, Alloc, Links >::clear() noexcept
   {
     while (!empty())
     {
@@ -264,44 +292,87 @@ namespace lopatina
     }
   }
 
-  template < typename T >
-  void List< T >::swap(List< T > & list)
+  template < typename T, typename Alloc, typename Links >
+  void List< T, Alloc, Links >::swap(List< T, Alloc, Links > & list)
   {
-    Node< T > * subhead = head_;
-    Node< T > * subtail = tail_;
+    Node< T, Links > * subhead = head_;
+    Node< T, Links > * subtail = tail_;
     head_ = list.head_;
     tail_ = list.tail_;
     list.head_ = subhead;
     list.tail_ = subtail;
+    std::swap(alloc_, list.alloc_);
   }
 
-  template < typename T >
-  Node< T > * List< T >::remove_node(Node< T > * prev_node, Node< T > * todelete)
+  template < typename T, typename Alloc, typename Links >
+  template < typename... Args >
+  Node< T, Links > * List< T, Alloc, Links >::create_node(Args &&... args)
   {
-    Node< T > * next_node = todelete->next_;
+    Node< T, Links > * node = node_traits::allocate(alloc_, 1);
+    try
+    {
+      node_traits::construct(alloc_, node, std::forward< Args >(args)...);
+    }
+    catch (...)
+    {
+      node_traits::deallocate(alloc_, node, 1);
+      throw;
+    }
+    return node;
+  }
+
+  template < typename T, typename Alloc, typename Links >
+  void List< T, Alloc, Links >::destroy_node(Node< T, Links > * node) noexcept
+  {
+    node_traits::destroy(alloc_, node);
+    node_traits::deallocate(alloc_, node, 1);
+  }
+
+  template < typename T, typename Alloc, typename Links >
+  Node< T, Links > * List< T, Alloc, Links >::remove_node(Node< T, Links > * prev_node, Node< T, Links > * todelete)
+  {
+    Node< T, Links > * next_node = todelete->next_;
     if (next_node == nullptr)
     {
-      delete todelete;
+      destroy_node(todelete);
       prev_node->next_ = nullptr;
       tail_ = prev_node;
     }
     else
     {
       prev_node->next_ = next_node;
-      delete todelete;
+      setPrev(next_node, prev_node);
+      destroy_node(todelete);
     }
     return next_node;
   }
 
-  template < typename T >
-  void List< T >::remove(const T & val)
+  template < typename T, typename Alloc, typename Links >
+  Node< T, Links > * List< T, Alloc, Links >::prev_node(Node< T, Links > * node, SinglyLinked) const noexcept
+  {
+    Node< T, Links > * prev = head_;
+    while (prev->next_ != node)
+    {
+      prev = prev->next_;
+    }
+    return prev;
+  }
+
+  template < typename T, typename Alloc, typename Links >
+  Node< T, Links > * List< T, Alloc, Links >::prev_node(Node< T, Links > * node, DoublyLinked) const noexcept
+  {
+    return node->prev_;
+  }
+
+  template < typename T, typename Alloc, typename Links >
+  void List< T, Alloc, Links >::remove(const T & val)
   {
     if (empty())
     {
       return;
     }
-    Node< T > * prev = head_;
-    Node< T > * todelete = head_->next_;
+    Node< T, Links > * prev = head_;
+    Node< T, Links > * todelete = head_->next_;
     while (todelete)
     {
       if (todelete->data_ == val)
@@ -320,16 +391,16 @@ namespace lopatina
     }
   }
 
-  template < typename T >
+  template < typename T, typename Alloc, typename Links >
   template < typename Predicate >
-  void List< T >::remove_if(Predicate pred)
+  void List< T, Alloc, Links >::remove_if(Predicate pred)
   {
     if (empty())
     {
       return;
     }
-    Node< T > * prev = head_;
-    Node< T > * todelete = head_->next_;
+    Node< T, Links > * prev = head_;
+    Node< T, Links > * todelete = head_->next_;
     while (todelete)
     {
       if (pred(todelete->data_))
@@ -348,8 +419,8 @@ namespace lopatina
     }
   }
 
-  template < typename T >
-  void List< T >::assign(size_t n, const T & val)
+  template < typename T, typename Alloc, typename Links >
+  void List< T, Alloc, Links >::assign(size_t n, const T & val)
   {
     try
     {
@@ -366,9 +437,9 @@ namespace lopatina
     }
   }
 
-  template < typename T >
+  template < typename T, typename Alloc, typename Links >
   template < typename InputIterator >
-  void List< T >::assign(InputIterator first, InputIterator last)
+  void List< T, Alloc, Links >::assign(InputIterator first, InputIterator last)
   {
     try
     {
@@ -385,82 +456,99 @@ namespace lopatina
     }
   }
 
-  template < typename T >
-  void List< T >::assign(std::initializer_list< T > init_list)
+  template < typename T, typename Alloc, typename Links >
+  void List< T, Alloc, Links >::assign(std::initializer_list< T > init_list)
   {
     assign(init_list.begin(), init_list.end());
   }
 
-  template < typename T >
-  void List< T >::reverse() noexcept
+  template < typename T, typename Alloc, typename Links >
+  void List< T, Alloc, Links >::reverse() noexcept
   {
     if (empty() || head_ == tail_)
     {
       return;
     }
-    Node< T > * prev = nullptr;
-    Node< T > * next = nullptr;
-    Node< T > * current = head_;
+    Node< T, Links > * prev = nullptr;
+    Node< T, Links > * next = nullptr;
+    Node< T, Links > * current = head_;
     while (current)
     {
       next = current->next_;
       current->next_ = prev;
+      setPrev(current, next);
       prev = current;
       current = next;
     }
-    Node< T > * subhead = head_;
+    Node< T, Links > * subhead = head_;
     head_ = tail_;
     tail_ = subhead;
   }
 
-  template < typename T >
-  ListIterator< T > List< T >::erase_after(const_iterator position)
+  template < typename T, typename Alloc, typename Links >
+  typename List< T, Alloc, Links >::iterator List< T, Alloc, Links >::erase_after(const_iterator position)
   {
-    Node< T > * pos_node = position.node_;
-    Node< T > * result = nullptr;
+    Node< T, Links > * pos_node = position.node_;
+    Node< T, Links > * result = nullptr;
     if (pos_node && pos_node->next_)
     {
       result = remove_node(pos_node, pos_node->next_);
     }
-    return iterator(result);
+    return iterator(result, std::addressof(tail_));
   }
 
-  template < typename T >
-  ListIterator< T > List< T >::erase_after(const_iterator position, const_iterator last)
+  template < typename T, typename Alloc, typename Links >
+  typename List< T, Alloc, Links >::iterator List< T, Alloc, Links >::erase_after(const_iterator position, const_iterator last)
   {
     while (position.node_->next_ != last.node_)
     {
       erase_after(position);
     }
-    return iterator(last.node_);
+    return iterator(last.node_, std::addressof(tail_));
   }
 
-  template < typename T >
-  ListIterator< T > List< T >::insert_after(const_iterator position, const T & val)
+  template < typename T, typename Alloc, typename Links >
+  typename List< T, Alloc, Links >::iterator List< T, Alloc, Links >::insert_after(const_iterator position, const T & val)
   {
-    Node< T > * pos_node = position.node_;
+    return link_after(position, create_node(val));
+  }
+
+  template < typename T, typename Alloc, typename Links >
+  typename List< T, Alloc, Links >::iterator List< T, Alloc, Links >::insert_after(const_iterator position, T && val)
+  {
+    return link_after(position, create_node(std::move(val)));
+  }
+
+  template < typename T, typename Alloc, typename Links >
+  typename List< T, Alloc, Links >::iterator List< T, Alloc, Links >::link_after(const_iterator position, Node< T, Links > * new_node)
+  {
+    Node< T, Links > * pos_node = position.node_;
     if (pos_node == tail_)
     {
-      push_back(val);
-      return iterator(tail_);
+      if (empty())
+      {
+        head_ = new_node;
+      }
+      else
+      {
+        tail_->next_ = new_node;
+        setPrev(new_node, tail_);
+      }
+      tail_ = new_node;
+      return iterator(tail_, std::addressof(tail_));
     }
-    Node< T > * next = pos_node->next_;
-    Node< T > * new_node = new Node< T >(val);
+    Node< T, Links > * next = pos_node->next_;
     pos_node->next_ = new_node;
     new_node->next_ = next;
-    return iterator(new_node);
+    setPrev(new_node, pos_node);
+    setPrev(next, new_node);
+    return iterator(new_node, std::addressof(tail_));
   }
 
-  template < typename T >
-  ListIterator< T > List< T >::insert_after(const_iterator position, T && val)
+  template < typename T, typename Alloc, typename Links >
+  typename List< T, Alloc, Links >::iterator List< T, Alloc, Links >::insert_after(const_iterator position, size_t n, const T & val)
   {
-    return insert_after(position, val);
-  }
-
-  template < typename T >
-  ListIterator< T > List< T >::insert_after(const_iterator position, size_t n, const T & val)
-  {
-    iterator result(position.node_);
+    iterator result(position.node_, std::addressof(tail_));
     for (size_t i = 0; i != n; ++i)
     {
       result = insert_after(result, val);
@@ -468,11 +556,11 @@ namespace lopatina
     return result;
   }
 
-  template < typename T >
+  template < typename T, typename Alloc, typename Links >
   template < typename InputIterator >
-  ListIterator< T > List< T >::insert_after(const_iterator position, InputIterator first, InputIterator last)
+  typename List< T, Alloc, Links >::iterator List< T, Alloc, Links >::insert_after(const_iterator position, InputIterator first, InputIterator last)
   {
-    iterator result(position.node_);
+    iterator result(position.node_, std::addressof(tail_));
     for (auto it = first; it != last; ++it)
     {
       result = insert_after(result, *it);
@@ -480,10 +568,10 @@ namespace lopatina
     return result;
   }
 
-  template < typename T >
-  ListIterator< T > List< T >::insert_after(const_iterator position, std::initializer_list< T > init_list)
+  template < typename T, typename Alloc, typename Links >
+  typename List< T, Alloc, Links >::iterator List< T, Alloc, Links >::insert_after(const_iterator position, std::initializer_list< T > init_list)
   {
-    iterator result(position.node_);
+    iterator result(position.node_, std::addressof(tail_));
     for (auto it = init_list.begin(); it != init_list.end(); ++it)
     {
       result = insert_after(result, *it);
@@ -491,10 +579,14 @@ namespace lopatina
     return result;
   }
 
-  template < typename T >
-  void List< T >::splice_after(const_iterator position, List< T > & fwdlst)
+  template < typename T, typename Alloc, typename Links >
+  void List< T, Alloc, Links >::splice_after(const_iterator position, List< T, Alloc, Links > & fwdlst)
   {
-    Node< T > * pos_node = position.node_;
+    Node< T, Links > * pos_node = position.node_;
+    if (fwdlst.empty())
+    {
+      return;
+    }
     if ((pos_node == nullptr) && (empty()))
     {
       head_ = fwdlst.head_;
@@ -502,31 +594,30 @@ namespace lopatina
     }
     else if (pos_node == tail_)
     {
-      pos_node->next_ == fwdlst.head_;
-      tail_ == fwdlst.tail_;
+      pos_node->next_ = fwdlst.head_;
+      setPrev(fwdlst.head_, pos_node);
+      tail_ = fwdlst.tail_;
     }
     else
     {
-      Node< T > * next = pos_node->next_;
+      Node< T, Links > * next = pos_node->next_;
       pos_node->next_ = fwdlst.head_;
+      setPrev(fwdlst.head_, pos_node);
       fwdlst.tail_->next_ = next;
-      if (next == head_)
-      {
-        head_ = pos_node->next_;
-      }
+      setPrev(next, fwdlst.tail_);
     }
     fwdlst.head_ = nullptr;
     fwdlst.tail_ = nullptr;
   }
 
-  template < typename T >
-  void List< T >::splice_after(const_iterator position, List< T > && fwdlst)
+  template < typename T, typename Alloc, typename Links >
+  void List< T, Alloc, Links >::splice_after(const_iterator position, List< T, Alloc, Links > && fwdlst)
   {
     splice_after(position, fwdlst);
   }
 
-  template < typename T >
-  void List< T >::splice_after(const_iterator position, List< T > & fwdlst, const_iterator it)
+  template < typename T, typename Alloc, typename Links >
+  void List< T, Alloc, Links >::splice_after(const_iterator position, List< T, Alloc, Links > & fwdlst, const_iterator it)
   {
     if ((position == it) || (position.node_ == it.node_->next_))
     {
@@ -535,18 +626,18 @@ namespace lopatina
     splice_after(position, fwdlst, it, it.node_->next_);
   }
 
-  template < typename T >
-  void List< T >::splice_after(const_iterator position, List< T > && fwdlst, const_iterator it)
+  template < typename T, typename Alloc, typename Links >
+  void List< T, Alloc, Links >::splice_after(const_iterator position, List< T, Alloc, Links > && fwdlst, const_iterator it)
   {
     splice_after(position, fwdlst, it);
   }
 
-  template < typename T >
-  void List< T >::splice_after(const_iterator position, List< T > & fwdlst, const_iterator first, const_iterator last)
+  template < typename T, typename Alloc, typename Links >
+  void List< T, Alloc, Links >::splice_after(const_iterator position, List< T, Alloc, Links > & fwdlst, const_iterator first, const_iterator last)
   {
-    Node< T > * pos_node = position.node_;
-    Node< T > * begin = first.node_->next_;
-    Node< T > * end = last.node_;
+    Node< T, Links > * pos_node = position.node_;
+    Node< T, Links > * begin = first.node_->next_;
+    Node< T, Links > * end = last.node_;
 
     if (first.node_->next_ == fwdlst.head_)
     {
@@ -557,47 +648,52 @@ namespace lopatina
       fwdlst.tail_ = first.node_;
     }
     first.node_->next_ = last.node_->next_;
+    setPrev(first.node_->next_, first.node_);
 
     if ((pos_node == nullptr) && (empty()))
     {
       head_ = begin;
+      setPrev(head_, static_cast< Node< T, Links > * >(nullptr));
       tail_ = end;
       tail_->next_ = nullptr;
     }
     else if (pos_node == tail_)
     {
       pos_node->next_ = begin;
+      setPrev(begin, pos_node);
       tail_ = end;
       tail_->next_ = nullptr;
     }
     else
     {
-      Node< T > * next = pos_node->next_;
+      Node< T, Links > * next = pos_node->next_;
       pos_node->next_ = begin;
+      setPrev(begin, pos_node);
       end->next_ = next;
+      setPrev(next, end);
     }
   }
 
-  template < typename T >
-  void List< T >::splice_after(const_iterator position, List< T > && fwdlst, const_iterator first, const_iterator last)
+  template < typename T, typename Alloc, typename Links >
+  void List< T, Alloc, Links >::splice_after(const_iterator position, List< T, Alloc, Links > && fwdlst, const_iterator first, const_iterator last)
   {
     splice_after(position, fwdlst, first, last);
   }
 
-  template < typename T >
-  T & List< T >::back()
+  template < typename T, typename Alloc, typename Links >
+  T & List< T, Alloc, Links >::back()
   {
     return tail_->data_;
   }
 
-  template < typename T >
-  const T & List< T >::back() const
+  template < typename T, typename Alloc, typename Links >
+  const T & List< T, Alloc, Links >::back() const
   {
     return tail_->data_;
   }
 
-  template < typename T >
-  void List< T >::pop_back()
+  template < typename T, typename Alloc, typename Links >
+  void List< T, Alloc, Links >::pop_back()
   {
     if (tail_ == nullptr)
     {
@@ -605,50 +701,67 @@ namespace lopatina
     }
     if (head_ == tail_)
     {
-      delete tail_;
+      destroy_node(tail_);
       head_ = nullptr;
       tail_ = nullptr;
       return;
     }
-    Node<T> * newptr = head_;
-    while (newptr->next_ != tail_)
-    {
-      newptr = newptr->next_;
-    }
+    Node< T, Links > * newptr = prev_node(tail_, Links());
     newptr->next_ = nullptr;
-    delete tail_;
+    destroy_node(tail_);
     tail_ = newptr;
   }
 
-  template < typename T >
-  ListIterator< T > List< T >::begin() noexcept
+  template < typename T, typename Alloc, typename Links >
+  typename List< T, Alloc, Links >::iterator List< T, Alloc, Links >::begin() noexcept
+  {
+    return iterator(head_, std::addressof(tail_));
+  }
+  template < typename T, typename Alloc, typename Links >
+  typename List< T, Alloc, Links >::iterator List< T, Alloc, Links >::end() noexcept
   {
-    return iterator(head_);
+    return iterator(nullptr, std::addressof(tail_));
   }
-  template < typename T >
-  ListIterator< T > List< T >::end() noexcept
+  template < typename T, typename Alloc, typename Links >
+  typename List< T, Alloc, Links >::const_iterator List< T, Alloc, Links >::begin() const noexcept
   {
-    return iterator();
+    return const_iterator(head_, std::addressof(tail_));
   }
-  template < typename T >
-  ConstListIterator< T > List< T >::begin() const noexcept
+  template < typename T, typename Alloc, typename Links >
+  typename List< T, Alloc, Links >::const_iterator List< T, Alloc, Links >::end() const noexcept
+  {
+    return const_iterator(nullptr, std::addressof(tail_));
+  }
+  template < typename T, typename Alloc, typename Links >
+  typename List< T, Alloc, Links >::const_iterator List< T, Alloc, Links >::cbegin() const noexcept
+  {
+    return const_iterator(head_, std::addressof(tail_));
+  }
+  template < typename T, typename Alloc, typename Links >
+  typename List< T, Alloc, Links >::const_iterator List< T, Alloc, Links >::cend() const noexcept
+  {
+    return const_iterator(nullptr, std::addressof(tail_));
+  }
+
+  template < typename T, typename Alloc, typename Links >
+  typename List< T, Alloc, Links >::reverse_iterator List< T, Alloc, Links >::rbegin() noexcept
   {
-    return const_iterator(head_);
+    return reverse_iterator(end());
   }
-  template < typename T >
-  ConstListIterator< T > List< T >::end() const noexcept
+  template < typename T, typename Alloc, typename Links >
+  typename List< T, Alloc, Links >::reverse_iterator List< T, Alloc, Links >::rend() noexcept
   {
-    return const_iterator();
+    return reverse_iterator(begin());
   }
-  template < typename T >
-  ConstListIterator< T > List< T >::cbegin() const noexcept
+  template < typename T, typename Alloc, typename Links >
+  typename List< T, Alloc, Links >::const_reverse_iterator List< T, Alloc, Links >::crbegin() const noexcept
   {
-    return const_iterator(head_);
+    return const_reverse_iterator(cend());
   }
-  template < typename T >
-  ConstListIterator< T > List< T >::cend() const noexcept
+  template < typename T, typename Alloc, typename Links >
+  typename List< T, Alloc, Links >::const_reverse_iterator List< T, Alloc, Links >::crend() const noexcept
   {
-    return const_iterator();
+    return const_reverse_iterator(cbegin());
   }
 }
 
@@ -1,32 +1,40 @@
-#ifndef ITERATOR_HPP
-#define ITERATOR_HPP
+#ifndef LIST_ITERATOR_HPP
+#define LIST_ITERATOR_HPP
 
 #include <iterator>
-#include <forward_list>
+#include <memory>
+#include <type_traits>
 #include <cassert>
 #include "node.hpp"
 
 namespace lopatina
 {
-  template < typename T >
+  template < typename T, typename Alloc, typename Links >
   class List;
 
-  template < typename T >
+  template < typename T, typename Links >
   struct ConstListIterator;
 
-  template < typename T >
-  struct ListIterator: public std::iterator< std::forward_iterator_tag, T >
+  template < typename T, typename Links = SinglyLinked >
+  struct ListIterator: public std::iterator<
+    typename std::conditional< std::is_same< Links, DoublyLinked >::value, std::bidirectional_iterator_tag, std::forward_iterator_tag >::type,
+    T
+  >
   {
-    friend class List< T >;
-    friend struct ConstListIterator< T >;
+    template < typename, typename, typename >
+    friend class List;
+    friend struct ConstListIterator< T, Links >;
 
   public:
-    using this_t = ListIterator< T >;
+    using this_t = ListIterator< T, Links >;
+    using node_t = Node< T, Links >;
     ListIterator():
-      node_(nullptr)
+      node_(nullptr),
+      tail_(nullptr)
     {}
-    ListIterator(Node< T > * node):
-      node_(node)
+    ListIterator(node_t * node, node_t * const * tail = nullptr):
+      node_(node),
+      tail_(tail)
     {}
     ~ListIterator() = default;
 
@@ -45,6 +53,26 @@ namespace lopatina
       ++(*this);
       return result;
     }
+    this_t & operator--()
+    {
+      static_assert(std::is_same< Links, DoublyLinked >::value, "Decrement requires a doubly linked list");
+      if (node_ == nullptr)
+      {
+        assert(tail_ != nullptr);
+        node_ = *tail_;
+      }
+      else
+      {
+        node_ = node_->prev_;
+      }
+      return *this;
+    }
+    this_t operator--(int)
+    {
+      this_t result(*this);
+      --(*this);
+      return result;
+    }
     T & operator*()
     {
       assert(node_ != nullptr);
@@ -66,7 +94,8 @@ namespace lopatina
     }
 
   private:
-    Node< T > * node_;
+    node_t * node_;
+    node_t * const * tail_;
   };
 }
 
@@ -1,19 +1,64 @@
 #ifndef NODE_HPP
 #define NODE_HPP
 
+#include <utility>
+
 namespace lopatina
 {
-  template < typename T >
+  struct SinglyLinked
+  {};
+  struct DoublyLinked
+  {};
+
+  template < typename T, typename Links = SinglyLinked >
   struct Node
   {
     T data_;
-    Node< T > * next_;
+    Node< T, Links > * next_;
 
     Node(const T & data):
       data_(data),
       next_(nullptr)
     {}
+
+    Node(T && data):
+      data_(std::move(data)),
+      next_(nullptr)
+    {}
+  };
+
+  template < typename T >
+  struct Node< T, DoublyLinked >
+  {
+    T data_;
+    Node< T, DoublyLinked > * next_;
+    Node< T, DoublyLinked > * prev_;
+
+    Node(const T & data):
+      data_(data),
+      next_(nullptr),
+      prev_(nullptr)
+    {}
+
+    Node(T && data):
+      data_(std::move(data)),
+      next_(nullptr),
+      prev_(nullptr)
+    {}
   };
+
+  template < typename T >
+  void setPrev(Node< T, SinglyLinked > *, Node< T, SinglyLinked > *) noexcept
+  {}
+
+  template < typename T >
+  void setPrev(Node< T, DoublyLinked > * node, Node< T, DoublyLinked > * prev) noexcept
+  {
+    if (node)
+    {
+      node->prev_ = prev;
+    }
+  }
 }
 
 #endif
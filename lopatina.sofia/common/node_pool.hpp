@@ -0,0 +1,208 @@
+#ifndef NODE_POOL_HPP
+#define NODE_POOL_HPP
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+
+namespace lopatina
+{
+  namespace detail
+  {
+    // One owner per slot size for the whole process, so a node may be freed on
+    // any thread. Each thread keeps a small cache of free slots and trades them
+    // with the owner in batches; the cache goes back to the owner when the
+    // thread exits. The owner is never destroyed: containers with static
+    // storage duration can release their nodes after main returns.
+    template < size_t Size, size_t Align >
+    class FreeListPool
+    {
+    public:
+      static FreeListPool & instance()
+      {
+        static FreeListPool * pool = new FreeListPool();
+        return *pool;
+      }
+
+      FreeListPool(const FreeListPool &) = delete;
+      FreeListPool & operator=(const FreeListPool &) = delete;
+
+      void * allocate()
+      {
+        Cache & cache = localCache();
+        if (cache.free_ == nullptr)
+        {
+          refill(cache);
+        }
+        Slot * slot = cache.free_;
+        cache.free_ = slot->next_;
+        --cache.count_;
+        return slot;
+      }
+      void deallocate(void * ptr) noexcept
+      {
+        Slot * slot = static_cast< Slot * >(ptr);
+        Cache & cache = localCache();
+        if (!cache.is_open_ || cache.is_closed_)
+        {
+          std::lock_guard< std::mutex > lock(mutex_);
+          slot->next_ = free_;
+          free_ = slot;
+          return;
+        }
+        slot->next_ = cache.free_;
+        cache.free_ = slot;
+        if (++cache.count_ > 2 * batch_)
+        {
+          release(cache, batch_);
+        }
+      }
+
+    private:
+      union Slot
+      {
+        Slot * next_;
+        typename std::aligned_storage< Size, Align >::type storage_;
+      };
+
+      struct Cache
+      {
+        Slot * free_;
+        size_t count_;
+        bool is_open_;
+        bool is_closed_;
+      };
+
+      struct CacheGuard
+      {
+        ~CacheGuard()
+        {
+          Cache & cache = localCache();
+          instance().release(cache, cache.count_);
+          cache.is_closed_ = true;
+        }
+      };
+
+      static constexpr size_t batch_ = 64;
+      static constexpr size_t min_chunk_ = 32;
+      static constexpr size_t max_chunk_ = 4096;
+
+      std::mutex mutex_;
+      Slot * free_;
+      Slot * chunks_;
+      size_t chunk_size_;
+
+      FreeListPool():
+        mutex_(),
+        free_(nullptr),
+        chunks_(nullptr),
+        chunk_size_(min_chunk_)
+      {}
+
+      static Cache & localCache() noexcept
+      {
+        static thread_local Cache cache = { nullptr, 0, false, false };
+        return cache;
+      }
+
+      void refill(Cache & cache)
+      {
+        if (!cache.is_open_)
+        {
+          static thread_local CacheGuard guard;
+          cache.is_open_ = true;
+        }
+        size_t count = cache.is_closed_ ? 1 : batch_;
+        std::lock_guard< std::mutex > lock(mutex_);
+        for (size_t i = 0; i < count; ++i)
+        {
+          if (free_ == nullptr)
+          {
+            grow();
+          }
+          Slot * slot = free_;
+          free_ = slot->next_;
+          slot->next_ = cache.free_;
+          cache.free_ = slot;
+          ++cache.count_;
+        }
+      }
+      void release(Cache & cache, size_t count) noexcept
+      {
+        std::lock_guard< std::mutex > lock(mutex_);
+        for (size_t i = 0; i < count; ++i)
+        {
+          Slot * slot = cache.free_;
+          cache.free_ = slot->next_;
+          slot->next_ = free_;
+          free_ = slot;
+        }
+        cache.count_ -= count;
+      }
+
+      void grow()
+      {
+        Slot * chunk = new Slot[chunk_size_];
+        chunk[0].next_ = chunks_;
+        chunks_ = chunk;
+        for (size_t i = chunk_size_ - 1; i > 0; --i)
+        {
+          chunk[i].next_ = free_;
+          free_ = std::addressof(chunk[i]);
+        }
+        if (chunk_size_ < max_chunk_)
+        {
+          chunk_size_ *= 2;
+        }
+      }
+    };
+  }
+
+  template < typename T >
+  class PoolAllocator
+  {
+  public:
+    using value_type = T;
+
+    PoolAllocator() noexcept = default;
+    template < typename U >
+    PoolAllocator(const PoolAllocator< U > &) noexcept
+    {}
+
+    T * allocate(size_t n)
+    {
+      if (n != 1)
+      {
+        return static_cast< T * >(::operator new(n * sizeof(T)));
+      }
+      return static_cast< T * >(pool_t::instance().allocate());
+    }
+    void deallocate(T * ptr, size_t n) noexcept
+    {
+      if (n != 1)
+      {
+        ::operator delete(ptr);
+        return;
+      }
+      pool_t::instance().deallocate(ptr);
+    }
+
+  private:
+    using pool_t = detail::FreeListPool< sizeof(T), alignof(T) >;
+  };
+
+  template < typename T, typename U >
+  bool operator==(const PoolAllocator< T > &, const PoolAllocator< U > &) noexcept
+  {
+    return true;
+  }
+  template < typename T, typename U >
+  bool operator!=(const PoolAllocator< T > &, const PoolAllocator< U > &) noexcept
+  {
+    return false;
+  }
+}
+
+#endif
@@ -0,0 +1,279 @@
+#ifndef RING_BUFFER_HPP
+#define RING_BUFFER_HPP
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace lopatina
+{
+  template < typename T >
+  class RingBuffer
+  {
+  public:
+    RingBuffer();
+    RingBuffer(const RingBuffer & other);
+    RingBuffer(RingBuffer && other) noexcept;
+    ~RingBuffer();
+
+    RingBuffer & operator=(const RingBuffer & other);
+    RingBuffer & operator=(RingBuffer && other) noexcept;
+
+    bool empty() const noexcept;
+    size_t size() const noexcept;
+    T & operator[](size_t pos);
+    const T & operator[](size_t pos) const;
+    T & front();
+    const T & front() const;
+    T & back();
+    const T & back() const;
+    void push_back(const T & val);
+    void push_back(T && val);
+    void pop_front();
+    void pop_back();
+    void clear() noexcept;
+    void swap(RingBuffer & other) noexcept;
+
+  private:
+    T * data_;
+    size_t capacity_;
+    size_t head_;
+    size_t size_;
+
+    size_t index(size_t pos) const noexcept;
+    template < typename U >
+    void growAndPush(U && val);
+  };
+
+  template < typename T >
+  RingBuffer< T >::RingBuffer():
+    data_(nullptr),
+    capacity_(0),
+    head_(0),
+    size_(0)
+  {}
+
+  template < typename T >
+  RingBuffer< T >::RingBuffer(const RingBuffer & other):
+    RingBuffer()
+  {
+    if (other.size_ == 0)
+    {
+      return;
+    }
+    data_ = static_cast< T * >(::operator new(other.size_ * sizeof(T)));
+    capacity_ = other.size_;
+    for (; size_ < other.size_; ++size_)
+    {
+      new (data_ + size_) T(other.data_[other.index(size_)]);
+    }
+  }
+
+  template < typename T >
+  RingBuffer< T >::RingBuffer(RingBuffer && other) noexcept:
+    data_(other.data_),
+    capacity_(other.capacity_),
+    head_(other.head_),
+    size_(other.size_)
+  {
+    other.data_ = nullptr;
+    other.capacity_ = 0;
+    other.head_ = 0;
+    other.size_ = 0;
+  }
+
+  template < typename T >
+  RingBuffer< T >::~RingBuffer()
+  {
+    clear();
+    ::operator delete(data_);
+  }
+
+  template < typename T >
+  RingBuffer< T > & RingBuffer< T >::operator=(const RingBuffer & other)
+  {
+    if (this != std::addressof(other))
+    {
+      RingBuffer copy{other};
+      swap(copy);
+    }
+    return *this;
+  }
+
+  template < typename T >
+  RingBuffer< T > & RingBuffer< T >::operator=(RingBuffer && other) noexcept
+  {
+    if (this != std::addressof(other))
+    {
+      RingBuffer temp{std::move(other)};
+      swap(temp);
+    }
+    return *this;
+  }
+
+  template < typename T >
+  bool RingBuffer< T >::empty() const noexcept
+  {
+    return size_ == 0;
+  }
+
+  template < typename T >
+  size_t RingBuffer< T >::size() const noexcept
+  {
+    return size_;
+  }
+
+  template < typename T >
+  T & RingBuffer< T >::operator[](size_t pos)
+  {
+    return data_[index(pos)];
+  }
+
+  template < typename T >
+  const T & RingBuffer< T >::operator[](size_t pos) const
+  {
+    return data_[index(pos)];
+  }
+
+  template < typename T >
+  T & RingBuffer< T >::front()
+  {
+    return data_[head_];
+  }
+
+  template < typename T >
+  const T & RingBuffer< T >::front() const
+  {
+    return data_[head_];
+  }
+
+  template < typename T >
+  T & RingBuffer< T >::back()
+  {
+    return data_[index(size_ - 1)];
+  }
+
+  template < typename T >
+  const T & RingBuffer< T >::back() const
+  {
+    return data_[index(size_ - 1)];
+  }
+
+  template < typename T >
+  void RingBuffer< T >::push_back(const T & val)
+  {
+    if (size_ == capacity_)
+    {
+      growAndPush(val);
+      return;
+    }
+    new (data_ + index(size_)) T(val);
+    ++size_;
+  }
+
+  template < typename T >
+  void RingBuffer< T >::push_back(T && val)
+  {
+    if (size_ == capacity_)
+    {
+      growAndPush(std::move(val));
+      return;
+    }
+    new (data_ + index(size_)) T(std::move(val));
+    ++size_;
+  }
+
+  template < typename T >
+  void RingBuffer< T >::pop_front()
+  {
+    if (empty())
+    {
+      return;
+    }
+    data_[head_].~T();
+    head_ = index(1);
+    --size_;
+  }
+
+  template < typename T >
+  void RingBuffer< T >::pop_back()
+  {
+    if (empty())
+    {
+      return;
+    }
+    data_[index(size_ - 1)].~T();
+    --size_;
+  }
+
+  template < typename T >
+  void RingBuffer< T >::clear() noexcept
+  {
+    for (size_t i = 0; i < size_; ++i)
+    {
+      data_[index(i)].~T();
+    }
+    head_ = 0;
+    size_ = 0;
+  }
+
+  template < typename T >
+  void RingBuffer< T >::swap(RingBuffer & other) noexcept
+  {
+    std::swap(data_, other.data_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(head_, other.head_);
+    std::swap(size_, other.size_);
+  }
+
+  template < typename T >
+  size_t RingBuffer< T >::index(size_t pos) const noexcept
+  {
+    pos += head_;
+    return (pos < capacity_) ? pos : pos - capacity_;
+  }
+
+  template < typename T >
+  template < typename U >
+  void RingBuffer< T >::growAndPush(U && val)
+  {
+    size_t new_capacity = (capacity_ == 0) ? 16 : capacity_ * 2;
+    T * new_data = static_cast< T * >(::operator new(new_capacity * sizeof(T)));
+    try
+    {
+      new (new_data + size_) T(std::forward< U >(val));
+    }
+    catch (...)
+    {
+      ::operator delete(new_data);
+      throw;
+    }
+    size_t moved = 0;
+    try
+    {
+      for (; moved < size_; ++moved)
+      {
+        new (new_data + moved) T(std::move_if_noexcept(data_[index(moved)]));
+      }
+    }
+    catch (...)
+    {
+      for (size_t i = 0; i < moved; ++i)
+      {
+        new_data[i].~T();
+      }
+      new_data[size_].~T();
+      ::operator delete(new_data);
+      throw;
+    }
+    size_t old_size = size_;
+    clear();
+    ::operator delete(data_);
+    data_ = new_data;
+    capacity_ = new_capacity;
+    size_ = old_size + 1;
+  }
+}
+
+#endif
@@ -7,7 +7,7 @@
 #include <functional>
 #include <vector>
 #include <bidirectional_list.hpp>
-#include <hash_table.hpp>
+#include <flat_hash_table.hpp>
 #include "delimeters.hpp"
 
 void namestnikov::doHelp(std::ostream & out)
@@ -49,7 +49,7 @@ void namestnikov::doCreate(std::istream & in, dictMain & mainMap, std::ostream &
     out << "The dictionary with name " << newName << " already exists.\n";
     return;
   }
-  HashTable< std::string, std::string > newDict;
+  dictWords newDict;
   mainMap[newName] = newDict;
   out << newName << " is successfully created.\n";
 }
@@ -81,17 +81,19 @@ void namestnikov::doFind(std::istream & in, dictMain & mainMap, std::ostream & o
   in >> dictName;
   std::string key = "";
   in >> key;
-  if (mainMap.find(dictName) == mainMap.end())
+  auto dictIt = mainMap.find(dictName);
+  if (dictIt == mainMap.end())
   {
     out << "The dictionary with name " << dictName << " doesn't exist.\n";
     return;
   }
-  if (mainMap[dictName].find(key) == mainMap[dictName].end())
+  auto wordIt = dictIt->second.find(key);
+  if (wordIt == dictIt->second.end())
   {
     out << "The word " << key << " doesn't exist in " << dictName << ".\n";
     return;
   }
-  out << mainMap[dictName][key] << "\n";
+  out << wordIt->second << "\n";
 }
 
 void namestnikov::doRemove(std::istream & in, dictMain & mainMap, std::ostream & out)
@@ -116,9 +118,9 @@ void namestnikov::doSubtract(std::istream & in, dictMain & mainMap, std::ostream
   in >> firstDict;
   std::string secondDict = "";
   in >> secondDict;
-  HashTable< std::string, std::string > res;
-  HashTable< std::string, std::string > first = mainMap.at(firstDict);
-  HashTable< std::string, std::string > second = mainMap.at(secondDict);
+  dictWords res;
+  const dictWords & first = mainMap.at(firstDict);
+  const dictWords & second = mainMap.at(secondDict);
   for (const auto & key1: first)
   {
     if (second.find(key1.first) == second.end())
@@ -126,7 +128,7 @@ void namestnikov::doSubtract(std::istream & in, dictMain & mainMap, std::ostream
       res.insert(key1.first, key1.second);
     }
   }
-  mainMap[resDict] = res;
+  mainMap[resDict] = std::move(res);
   out << "Dictionary " << resDict << " is successfully created.\n";
 }
 
@@ -138,9 +140,9 @@ void namestnikov::doMerge(std::istream & in, dictMain & mainMap, std::ostream &
   in >> firstDict;
   std::string secondDict = "";
   in >> secondDict;
-  HashTable< std::string, std::string > res;
-  HashTable< std::string, std::string > first = mainMap.at(firstDict);
-  HashTable< std::string, std::string > second = mainMap.at(secondDict);
+  dictWords res;
+  const dictWords & first = mainMap.at(firstDict);
+  const dictWords & second = mainMap.at(secondDict);
   for (const auto & key1: first)
   {
     res.insert(key1.first, key1.second);
@@ -152,7 +154,7 @@ void namestnikov::doMerge(std::istream & in, dictMain & mainMap, std::ostream &
       res.insert(key2.first, key2.second);
     }
   }
-  mainMap[resDict] = res;
+  mainMap[resDict] = std::move(res);
   out << "Dictionary " << resDict << " is successfully created.\n";
 }
 
@@ -172,7 +174,7 @@ void namestnikov::doExport(std::istream & in, const dictMain & mainMap)
     throw std::invalid_argument("Can't open this file");
   }
   outFile << dict << "\n";
-  HashTable< std::string, std::string > res = mainMap.at(dict);
+  const dictWords & res = mainMap.at(dict);
   for (const auto & pair: res)
   {
     outFile << pair.first << " - " << pair.second << "\n";
@@ -196,7 +198,7 @@ void namestnikov::doImport(std::istream & in, dictMain & mainMap)
   }
   std::string resDict = "";
   inFile >> resDict;
-  HashTable< std::string, std::string > res;
+  dictWords res;
   std::string key = "";
   std::string value = "";
   using delC = namestnikov::DelimeterChar;
@@ -204,7 +206,7 @@ void namestnikov::doImport(std::istream & in, dictMain & mainMap)
   {
     res.insert(key, value);
   }
-  mainMap[resDict] = res;
+  mainMap[resDict] = std::move(res);
 }
 
 void namestnikov::doPrefix(std::istream & in, dictMain & mainMap, std::ostream & out)
@@ -213,13 +215,13 @@ void namestnikov::doPrefix(std::istream & in, dictMain & mainMap, std::ostream &
   in >> newDict;
   std::string dict = "";
   in >> dict;
-  HashTable< std::string, std::string > searchDict = mainMap.at(dict);
+  const dictWords & searchDict = mainMap.at(dict);
   if (searchDict.empty())
   {
     out << dict << " is empty.\n";
     return;
   }
-  HashTable< std::string, std::string > res;
+  dictWords res;
   std::string prefix = "";
   in >> prefix;
   for (const auto & key: searchDict)
@@ -234,7 +236,7 @@ void namestnikov::doPrefix(std::istream & in, dictMain & mainMap, std::ostream &
     out << "There aren't any words in " << dict << " with prefix " << prefix << ".\n";
     return;
   }
-  mainMap[newDict] = res;
+  mainMap[newDict] = std::move(res);
 }
 
 void namestnikov::doPostfix(std::istream & in, dictMain & mainMap, std::ostream & out)
@@ -243,13 +245,13 @@ void namestnikov::doPostfix(std::istream & in, dictMain & mainMap, std::ostream
   in >> newDict;
   std::string dict = "";
   in >> dict;
-  HashTable< std::string, std::string > searchDict = mainMap.at(dict);
+  const dictWords & searchDict = mainMap.at(dict);
   if (searchDict.empty())
   {
     out << dict << " is empty.\n";
     return;
   }
-  HashTable< std::string, std::string > res;
+  dictWords res;
   std::string postfix = "";
   in >> postfix;
   for (const auto & key: searchDict)
@@ -264,7 +266,7 @@ void namestnikov::doPostfix(std::istream & in, dictMain & mainMap, std::ostream
     out << "There aren't any words in " << dict << " with postfix " << postfix << ".\n";
     return;
   }
-  mainMap[newDict] = res;
+  mainMap[newDict] = std::move(res);
 }
 
 bool hasBetween(const std::pair< std::string, std::string > & pairDict, const std::string & sub)
@@ -293,13 +295,13 @@ void namestnikov::doSuffix(std::istream & in, dictMain & mainMap, std::ostream &
   in >> newDict;
   std::string dict = "";
   in >> dict;
-  HashTable< std::string, std::string > searchDict = mainMap.at(dict);
+  const dictWords & searchDict = mainMap.at(dict);
   if (searchDict.empty())
   {
     out << dict << " is empty.\n";
     return;
   }
-  HashTable< std::string, std::string > res;
+  dictWords res;
   std::string suffix = "";
   in >> suffix;
   for (const auto & key: searchDict)
@@ -314,7 +316,7 @@ void namestnikov::doSuffix(std::istream & in, dictMain & mainMap, std::ostream &
     out << "There aren't any words in " << dict << " with suffix " << suffix << ".\n";
     return;
   }
-  mainMap[newDict] = res;
+  mainMap[newDict] = std::move(res);
 }
 
 void namestnikov::doPalindrome(std::istream & in, dictMain & mainMap, std::ostream & out)
@@ -322,7 +324,7 @@ void namestnikov::doPalindrome(std::istream & in, dictMain & mainMap, std::ostre
   std::string dictName = "";
   in >> dictName;
   List< std::string > palindromes;
-  HashTable< std::string, std::string > searchDict = mainMap.at(dictName);
+  const dictWords & searchDict = mainMap.at(dictName);
   for (const auto & pair1: searchDict)
   {
     for (const auto & pair2: searchDict)
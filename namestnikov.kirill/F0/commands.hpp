@@ -1,12 +1,15 @@
 #ifndef COMMANDS_HPP
 #define COMMANDS_HPP
 
+#include <functional>
 #include <string>
-#include <hash_table.hpp>
+#include <flat_hash_table.hpp>
+#include <string_hash.hpp>
 
 namespace namestnikov
 {
-  using dictMain = HashTable< std::string, HashTable< std::string, std::string > >;
+  using dictWords = FlatHashTable< std::string, std::string, StringHash, std::equal_to<> >;
+  using dictMain = FlatHashTable< std::string, dictWords, StringHash, std::equal_to<> >;
   void doHelp(std::ostream & out);
   void doCreate(std::istream & in, dictMain & mainMap, std::ostream & out);
   void doAdd(std::istream & in, dictMain & mainMap, std::ostream & out);
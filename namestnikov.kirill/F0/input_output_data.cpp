@@ -2,11 +2,11 @@
 #include <stdexcept>
 #include "delimeters.hpp"
 
-namestnikov::HashTable< std::string, std::string > namestnikov::inputDict(std::ifstream & in)
+namestnikov::dictWords namestnikov::inputDict(std::ifstream & in)
 {
   std::string key = "";
   std::string value = "";
-  HashTable< std::string, std::string > res;
+  dictWords res;
   using delC = DelimeterChar;
   while (in >> key >> delC{'-'} >> value)
   {
@@ -19,7 +19,7 @@ namestnikov::HashTable< std::string, std::string > namestnikov::inputDict(std::i
   return res;
 }
 
-void namestnikov::outputDict(std::ofstream & out, const HashTable< std::string, std::string > & dict)
+void namestnikov::outputDict(std::ofstream & out, const dictWords & dict)
 {
   for (const auto & pair: dict)
   {
@@ -2,12 +2,12 @@
 #define INPUT_OUTPUT_DATA_HPP
 
 #include <fstream>
-#include <hash_table.hpp>
+#include "commands.hpp"
 
 namespace namestnikov
 {
-  HashTable< std::string, std::string > inputDict(std::ifstream & in);
-  void outputDict(std::ofstream & out, const HashTable< std::string, std::string > & dict);
+  dictWords inputDict(std::ifstream & in);
+  void outputDict(std::ofstream & out, const dictWords & dict);
 }
 
 #endif
@@ -10,7 +10,6 @@
 int main(int argc, char * argv[])
 {
   using namespace namestnikov;
-  using dictMain = HashTable< std::string, HashTable< std::string, std::string > >;
   dictMain myMap;
   try
   {
@@ -29,8 +28,7 @@ int main(int argc, char * argv[])
           std::cerr << "Cannot open file\n";
           return 1;
         }
-        HashTable< std::string, std::string > res = inputDict(inFile);
-        myMap[argv[i]] = res;
+        myMap[argv[i]] = inputDict(inFile);
       }
     }
   }
@@ -39,7 +37,7 @@ int main(int argc, char * argv[])
     std::cerr << "Error while trying to read dicts\n";
     return 1;
   }
-  HashTable< std::string, std::function< void(std::istream &) > > commands;
+  FlatHashTable< std::string, std::function< void(std::istream &) >, StringHash, std::equal_to<> > commands;
   {
     using namespace std::placeholders;
     commands["add"] = std::bind(doAdd, _1, std::ref(myMap), std::ref(std::cout));
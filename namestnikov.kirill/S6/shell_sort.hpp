@@ -1,27 +1,71 @@
 #ifndef SHELL_SORT_HPP
 #define SHELL_SORT_HPP
 
+#include <algorithm>
 #include <cstddef>
 #include <iterator>
+#include <vector>
 
 namespace namestnikov
 {
-  template< class Iter, class Compare >
-  void doShellSort(Iter begin, size_t size, Compare compare)
+  namespace detail
   {
-    for (size_t gap = size / 2; gap > 0; gap /= 2)
+    inline std::vector< size_t > getShellGaps(size_t size)
     {
-      for (size_t i = gap; i < size; ++i)
+      const size_t ciuraGaps[] = {1, 4, 10, 23, 57, 132, 301, 701, 1750};
+      std::vector< size_t > gaps;
+      for (size_t gap : ciuraGaps)
       {
-        auto temp = *std::next(begin, i);
-        size_t j = i;
-        for (; ((j >= gap) && (compare(temp, *std::next(begin, j - gap)))); j -= gap)
+        if ((gap >= size) && (!gaps.empty()))
         {
-          *std::next(begin, j) = *std::next(begin, j - gap);
+          return gaps;
         }
-        *std::next(begin, j) = temp;
+        gaps.push_back(gap);
       }
+      while (gaps.back() * 9 / 4 < size)
+      {
+        gaps.push_back(gaps.back() * 9 / 4);
+      }
+      return gaps;
     }
+
+    template< class Iter, class Compare >
+    void doShellSort(Iter begin, size_t size, Compare compare, std::random_access_iterator_tag)
+    {
+      std::vector< size_t > gaps = getShellGaps(size);
+      for (auto gapIter = gaps.crbegin(); gapIter != gaps.crend(); ++gapIter)
+      {
+        size_t gap = *gapIter;
+        for (size_t i = gap; i < size; ++i)
+        {
+          auto temp = std::move(begin[i]);
+          size_t j = i;
+          for (; ((j >= gap) && (compare(temp, begin[j - gap]))); j -= gap)
+          {
+            begin[j] = std::move(begin[j - gap]);
+          }
+          begin[j] = std::move(temp);
+        }
+      }
+    }
+
+    template< class Iter, class Compare >
+    void doShellSort(Iter begin, size_t size, Compare compare, std::forward_iterator_tag)
+    {
+      using value_t = typename std::iterator_traits< Iter >::value_type;
+      std::vector< value_t > buffer;
+      buffer.reserve(size);
+      std::copy_n(std::make_move_iterator(begin), size, std::back_inserter(buffer));
+      doShellSort(buffer.begin(), size, compare, std::random_access_iterator_tag());
+      std::move(buffer.begin(), buffer.end(), begin);
+    }
+  }
+
+  template< class Iter, class Compare >
+  void doShellSort(Iter begin, size_t size, Compare compare)
+  {
+    using category_t = typename std::iterator_traits< Iter >::iterator_category;
+    detail::doShellSort(begin, size, compare, category_t());
   }
 }
 
@@ -146,27 +146,11 @@ namespace namestnikov
     }
     void push_front(const T & value)
     {
-      try
-      {
-        insert(begin(), value);
-      }
-      catch (...)
-      {
-        clear();
-        throw;
-      }
+      insert(begin(), value);
     }
     void push_back(const T & value)
     {
-      try
-      {
-        insert(end(), value);
-      }
-      catch (...)
-      {
-        clear();
-        throw;
-      }
+      insert(end(), value);
     }
     void pop_front()
     {
@@ -194,30 +178,23 @@ namespace namestnikov
     }
     iterator insert(iterator pos, const T & value)
     {
-      try
-      {
-        node_t * newNode = new node_t(value);
-        base_node_t* currentNode = pos.node_;
-        newNode->next = currentNode;
-        if (size_)
-        {
-          currentNode->prev->next = newNode;
-          newNode->prev = currentNode->prev;
-        }
-        else
-        {
-          newNode->prev = currentNode;
-          currentNode->next = newNode;
-        }
-        currentNode->prev = newNode;
-        ++size_;
-        return iterator(newNode);
-      }
-      catch (...)
+      node_t * newNode = new node_t(value);
+      link(pos.node_, newNode);
+      ++size_;
+      return iterator(newNode);
+    }
+    void splice(iterator pos, List & other, iterator it) noexcept
+    {
+      base_node_t * node = it.node_;
+      if ((node == pos.node_) || (node->next == pos.node_))
       {
-        clear();
-        throw;
+        return;
       }
+      node->prev->next = node->next;
+      node->next->prev = node->prev;
+      --other.size_;
+      link(pos.node_, node);
+      ++size_;
     }
     iterator erase(iterator pos)
     {
@@ -268,6 +245,21 @@ namespace namestnikov
   private:
     size_t size_;
     base_node_t * fakeNode_;
+    void link(base_node_t * currentNode, base_node_t * newNode) noexcept
+    {
+      newNode->next = currentNode;
+      if (size_)
+      {
+        currentNode->prev->next = newNode;
+        newNode->prev = currentNode->prev;
+      }
+      else
+      {
+        newNode->prev = currentNode;
+        currentNode->next = newNode;
+      }
+      currentNode->prev = newNode;
+    }
   };
 }
 
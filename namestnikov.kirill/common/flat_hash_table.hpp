@@ -0,0 +1,429 @@
+#ifndef FLAT_HASH_TABLE_HPP
+#define FLAT_HASH_TABLE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace namestnikov
+{
+  namespace detail
+  {
+    struct FlatHashSlot
+    {
+      size_t hash;
+      size_t entry;
+    };
+  }
+
+  // Robin Hood open addressing over a power-of-two slot array. Slots only hold
+  // the hash and an index into a dense entry array, so probing never touches
+  // keys until the hashes match and iteration is a linear walk over entries.
+  // Keys must not be modified through iterators. When both Hash and KeyEqual
+  // declare is_transparent, find/count/at also accept any type they accept.
+  template< class Key, class Value, class Hash = std::hash< Key >, class KeyEqual = std::equal_to< Key > >
+  class FlatHashTable
+  {
+  public:
+    using val_type_t = std::pair< Key, Value >;
+    using iterator = val_type_t *;
+    using const_iterator = const val_type_t *;
+
+    FlatHashTable() noexcept:
+      slots_(nullptr),
+      mask_(0),
+      entries_(nullptr),
+      capacity_(0),
+      count_(0),
+      maxLoadFactor_(0.875f)
+    {}
+    FlatHashTable(const FlatHashTable & other):
+      FlatHashTable()
+    {
+      maxLoadFactor_ = other.maxLoadFactor_;
+      if (other.count_ == 0)
+      {
+        return;
+      }
+      slots_ = new detail::FlatHashSlot[other.mask_ + 1];
+      mask_ = other.mask_;
+      std::copy(other.slots_, other.slots_ + mask_ + 1, slots_);
+      entries_ = allocateEntries(other.count_);
+      capacity_ = other.count_;
+      for (; count_ < other.count_; ++count_)
+      {
+        new (entries_ + count_) val_type_t(other.entries_[count_]);
+      }
+    }
+    FlatHashTable(FlatHashTable && other) noexcept:
+      FlatHashTable()
+    {
+      swap(other);
+    }
+    FlatHashTable & operator=(const FlatHashTable & other)
+    {
+      if (this != std::addressof(other))
+      {
+        FlatHashTable temp(other);
+        swap(temp);
+      }
+      return *this;
+    }
+    FlatHashTable & operator=(FlatHashTable && other) noexcept
+    {
+      if (this != std::addressof(other))
+      {
+        FlatHashTable temp(std::move(other));
+        swap(temp);
+      }
+      return *this;
+    }
+    ~FlatHashTable()
+    {
+      destroyEntries();
+      ::operator delete(entries_);
+      delete[] slots_;
+    }
+    void swap(FlatHashTable & other) noexcept
+    {
+      std::swap(slots_, other.slots_);
+      std::swap(mask_, other.mask_);
+      std::swap(entries_, other.entries_);
+      std::swap(capacity_, other.capacity_);
+      std::swap(count_, other.count_);
+      std::swap(maxLoadFactor_, other.maxLoadFactor_);
+    }
+    Value & operator[](const Key & key)
+    {
+      size_t hash = hashOf(key);
+      size_t index = findEntry(key, hash);
+      if (index == count_)
+      {
+        index = emplaceEntry(hash, key, Value());
+      }
+      return entries_[index].second;
+    }
+    Value & at(const Key & key)
+    {
+      size_t index = findEntry(key, hashOf(key));
+      if (index == count_)
+      {
+        throw std::out_of_range("There are not value with specific key");
+      }
+      return entries_[index].second;
+    }
+    const Value & at(const Key & key) const
+    {
+      size_t index = findEntry(key, hashOf(key));
+      if (index == count_)
+      {
+        throw std::out_of_range("There are not value with specific key");
+      }
+      return entries_[index].second;
+    }
+    template< class K, class H = Hash, class E = KeyEqual, class = typename H::is_transparent, class = typename E::is_transparent >
+    Value & at(const K & key)
+    {
+      size_t index = findEntry(key, hashOf(key));
+      if (index == count_)
+      {
+        throw std::out_of_range("There are not value with specific key");
+      }
+      return entries_[index].second;
+    }
+    template< class K, class H = Hash, class E = KeyEqual, class = typename H::is_transparent, class = typename E::is_transparent >
+    const Value & at(const K & key) const
+    {
+      size_t index = findEntry(key, hashOf(key));
+      if (index == count_)
+      {
+        throw std::out_of_range("There are not value with specific key");
+      }
+      return entries_[index].second;
+    }
+    bool empty() const noexcept
+    {
+      return (count_ == 0);
+    }
+    size_t size() const noexcept
+    {
+      return count_;
+    }
+    size_t bucketCount() const noexcept
+    {
+      return (slots_ == nullptr) ? 0 : mask_ + 1;
+    }
+    float max_load_factor() const noexcept
+    {
+      return maxLoadFactor_;
+    }
+    void max_load_factor(float ml)
+    {
+      if (!((ml > 0.0f) && (ml < 1.0f)))
+      {
+        throw std::invalid_argument("Max load factor must be in (0, 1)");
+      }
+      maxLoadFactor_ = ml;
+      reserve(count_);
+    }
+    void reserve(size_t count)
+    {
+      size_t slotCount = (slots_ == nullptr) ? 16 : mask_ + 1;
+      while (count >= slotCount * maxLoadFactor_)
+      {
+        slotCount *= 2;
+      }
+      if ((slots_ == nullptr) || (slotCount != mask_ + 1))
+      {
+        resizeSlots(slotCount);
+      }
+      if (capacity_ < count)
+      {
+        resizeEntries(count);
+      }
+    }
+    void clear() noexcept
+    {
+      destroyEntries();
+      if (slots_ != nullptr)
+      {
+        std::fill(slots_, slots_ + mask_ + 1, detail::FlatHashSlot{0, 0});
+      }
+    }
+    std::pair< iterator, bool > insert(const Key & key, const Value & value)
+    {
+      size_t hash = hashOf(key);
+      size_t index = findEntry(key, hash);
+      if (index != count_)
+      {
+        return std::pair< iterator, bool >(entries_ + index, false);
+      }
+      index = emplaceEntry(hash, key, value);
+      return std::pair< iterator, bool >(entries_ + index, true);
+    }
+    bool erase(const Key & key)
+    {
+      size_t index = findEntry(key, hashOf(key));
+      if (index == count_)
+      {
+        return false;
+      }
+      erase(entries_ + index);
+      return true;
+    }
+    iterator erase(const_iterator pos)
+    {
+      size_t index = pos - entries_;
+      size_t last = count_ - 1;
+      removeSlot(findSlot(index, hashOf(pos->first)));
+      if (index != last)
+      {
+        slots_[findSlot(last, hashOf(entries_[last].first))].entry = index + 1;
+        entries_[index] = std::move(entries_[last]);
+      }
+      entries_[last].~val_type_t();
+      --count_;
+      return entries_ + index;
+    }
+    iterator find(const Key & key)
+    {
+      return entries_ + findEntry(key, hashOf(key));
+    }
+    const_iterator find(const Key & key) const
+    {
+      return entries_ + findEntry(key, hashOf(key));
+    }
+    template< class K, class H = Hash, class E = KeyEqual, class = typename H::is_transparent, class = typename E::is_transparent >
+    iterator find(const K & key)
+    {
+      return entries_ + findEntry(key, hashOf(key));
+    }
+    template< class K, class H = Hash, class E = KeyEqual, class = typename H::is_transparent, class = typename E::is_transparent >
+    const_iterator find(const K & key) const
+    {
+      return entries_ + findEntry(key, hashOf(key));
+    }
+    size_t count(const Key & key) const
+    {
+      return (findEntry(key, hashOf(key)) != count_);
+    }
+    template< class K, class H = Hash, class E = KeyEqual, class = typename H::is_transparent, class = typename E::is_transparent >
+    size_t count(const K & key) const
+    {
+      return (findEntry(key, hashOf(key)) != count_);
+    }
+    iterator begin() noexcept
+    {
+      return entries_;
+    }
+    iterator end() noexcept
+    {
+      return entries_ + count_;
+    }
+    const_iterator begin() const noexcept
+    {
+      return entries_;
+    }
+    const_iterator end() const noexcept
+    {
+      return entries_ + count_;
+    }
+    const_iterator cbegin() const noexcept
+    {
+      return entries_;
+    }
+    const_iterator cend() const noexcept
+    {
+      return entries_ + count_;
+    }
+  private:
+    detail::FlatHashSlot * slots_;
+    size_t mask_;
+    val_type_t * entries_;
+    size_t capacity_;
+    size_t count_;
+    float maxLoadFactor_;
+
+    static val_type_t * allocateEntries(size_t count)
+    {
+      return static_cast< val_type_t * >(::operator new(count * sizeof(val_type_t)));
+    }
+    template< class K >
+    size_t hashOf(const K & key) const
+    {
+      size_t hash = Hash()(key) * static_cast< size_t >(0x9E3779B97F4A7C15ull);
+      return hash ^ (hash >> (sizeof(size_t) * 4));
+    }
+    size_t probeDistance(size_t hash, size_t pos) const noexcept
+    {
+      return (pos - (hash & mask_)) & mask_;
+    }
+    template< class K >
+    size_t findEntry(const K & key, size_t hash) const
+    {
+      if (count_ == 0)
+      {
+        return count_;
+      }
+      for (size_t pos = hash & mask_, dist = 0; ; pos = (pos + 1) & mask_, ++dist)
+      {
+        const detail::FlatHashSlot & slot = slots_[pos];
+        if ((slot.entry == 0) || (probeDistance(slot.hash, pos) < dist))
+        {
+          return count_;
+        }
+        if ((slot.hash == hash) && KeyEqual()(entries_[slot.entry - 1].first, key))
+        {
+          return slot.entry - 1;
+        }
+      }
+    }
+    size_t findSlot(size_t index, size_t hash) const noexcept
+    {
+      size_t pos = hash & mask_;
+      while (slots_[pos].entry != index + 1)
+      {
+        pos = (pos + 1) & mask_;
+      }
+      return pos;
+    }
+    void placeSlot(detail::FlatHashSlot slot) noexcept
+    {
+      for (size_t pos = slot.hash & mask_, dist = 0; ; pos = (pos + 1) & mask_, ++dist)
+      {
+        if (slots_[pos].entry == 0)
+        {
+          slots_[pos] = slot;
+          return;
+        }
+        size_t existing = probeDistance(slots_[pos].hash, pos);
+        if (existing < dist)
+        {
+          std::swap(slot, slots_[pos]);
+          dist = existing;
+        }
+      }
+    }
+    void removeSlot(size_t pos) noexcept
+    {
+      size_t next = (pos + 1) & mask_;
+      while ((slots_[next].entry != 0) && (probeDistance(slots_[next].hash, next) != 0))
+      {
+        slots_[pos] = slots_[next];
+        pos = next;
+        next = (next + 1) & mask_;
+      }
+      slots_[pos] = detail::FlatHashSlot{0, 0};
+    }
+    size_t emplaceEntry(size_t hash, const Key & key, const Value & value)
+    {
+      if ((slots_ == nullptr) || (count_ + 1 > (mask_ + 1) * maxLoadFactor_))
+      {
+        resizeSlots((slots_ == nullptr) ? 16 : (mask_ + 1) * 2);
+      }
+      if (count_ == capacity_)
+      {
+        resizeEntries((capacity_ == 0) ? 8 : capacity_ * 2);
+      }
+      new (entries_ + count_) val_type_t(key, value);
+      placeSlot(detail::FlatHashSlot{hash, count_ + 1});
+      return count_++;
+    }
+    void resizeSlots(size_t newCapacity)
+    {
+      detail::FlatHashSlot * oldSlots = slots_;
+      size_t oldCapacity = (slots_ == nullptr) ? 0 : mask_ + 1;
+      slots_ = new detail::FlatHashSlot[newCapacity]();
+      mask_ = newCapacity - 1;
+      for (size_t i = 0; i < oldCapacity; ++i)
+      {
+        if (oldSlots[i].entry != 0)
+        {
+          placeSlot(oldSlots[i]);
+        }
+      }
+      delete[] oldSlots;
+    }
+    void resizeEntries(size_t newCapacity)
+    {
+      val_type_t * newEntries = allocateEntries(newCapacity);
+      size_t moved = 0;
+      try
+      {
+        for (; moved < count_; ++moved)
+        {
+          new (newEntries + moved) val_type_t(std::move_if_noexcept(entries_[moved]));
+        }
+      }
+      catch (...)
+      {
+        for (size_t i = 0; i < moved; ++i)
+        {
+          newEntries[i].~val_type_t();
+        }
+        ::operator delete(newEntries);
+        throw;
+      }
+      size_t oldCount = count_;
+      destroyEntries();
+      ::operator delete(entries_);
+      entries_ = newEntries;
+      capacity_ = newCapacity;
+      count_ = oldCount;
+    }
+    void destroyEntries() noexcept
+    {
+      for (size_t i = 0; i < count_; ++i)
+      {
+        entries_[i].~val_type_t();
+      }
+      count_ = 0;
+    }
+  };
+}
+
+#endif
@@ -3,7 +3,6 @@
 
 #include <initializer_list>
 #include <stdexcept>
-#include <cmath>
 #include <cstddef>
 #include <utility>
 #include <hash_table_node.hpp>
@@ -26,6 +25,7 @@ namespace namestnikov
     HashTable():
       capacity_(5),
       count_(0),
+      maxLoadFactor_(0.75f),
       buckets_(new list_iterator[5]),
       elements_()
     {
@@ -37,6 +37,7 @@ namespace namestnikov
     HashTable(const HashTable< Key, Value > & other):
       capacity_(other.capacity_),
       count_(0),
+      maxLoadFactor_(other.maxLoadFactor_),
       buckets_(new list_iterator[other.capacity_]),
       elements_()
     {
@@ -75,6 +76,7 @@ namespace namestnikov
     HashTable(HashTable< Key, Value > && other) noexcept:
       capacity_(other.capacity_),
       count_(other.count_),
+      maxLoadFactor_(other.maxLoadFactor_),
       buckets_(other.buckets_),
       elements_(std::move(other.elements_))
     {
@@ -95,6 +97,7 @@ namespace namestnikov
     {
       std::swap(capacity_, other.capacity_);
       std::swap(count_, other.count_);
+      std::swap(maxLoadFactor_, other.maxLoadFactor_);
       std::swap(elements_, other.elements_);
       std::swap(buckets_, other.buckets_);
     }
@@ -133,6 +136,27 @@ namespace namestnikov
     {
       return count_;
     }
+    float max_load_factor() const noexcept
+    {
+      return maxLoadFactor_;
+    }
+    void max_load_factor(float ml)
+    {
+      if (!(ml > 0.0f))
+      {
+        throw std::invalid_argument("Max load factor must be positive");
+      }
+      maxLoadFactor_ = ml;
+      rehash(0);
+    }
+    void reserve(size_t count)
+    {
+      size_t needed = static_cast< size_t >(count / maxLoadFactor_) + 1;
+      if (capacity_ < needed)
+      {
+        rehash(needed);
+      }
+    }
     void clear()
     {
       auto it = elements_.begin();
@@ -221,12 +245,13 @@ namespace namestnikov
   private:
     size_t capacity_;
     size_t count_;
+    float maxLoadFactor_;
     list_iterator * buckets_;
     List< node_t * > elements_;
     void rehash(size_t count)
     {
       size_t newCapacity = 5;
-      while ((newCapacity < count) || (newCapacity < (count_ / 0.75)))
+      while ((newCapacity < count) || (newCapacity < (count_ / maxLoadFactor_)))
       {
         newCapacity = calculateNextCapacity(newCapacity);
       }
@@ -234,51 +259,37 @@ namespace namestnikov
       {
         return;
       }
-      try
+      list_iterator * newBuckets = new list_iterator[newCapacity];
+      for (size_t i = 0; i < newCapacity; ++i)
       {
-        List< node_t * > newElements;
-        list_iterator * newBuckets = new list_iterator[newCapacity] {};
-        for (size_t i = 0; i < newCapacity; ++i)
+        newBuckets[i] = elements_.end();
+      }
+      for (size_t i = 0; i < count_; ++i)
+      {
+        list_iterator it = elements_.begin();
+        size_t index = (*it)->hash % newCapacity;
+        if (newBuckets[index] == elements_.end())
         {
-          newBuckets[i] = newElements.end();
+          elements_.splice(elements_.end(), elements_, it);
         }
-        auto it = elements_.begin();
-        auto temp = it;
-        while (it != elements_.end())
+        else
         {
-          size_t index = (*it)->hash % newCapacity;
-          if (newBuckets[index] == newElements.end())
-          {
-            newElements.push_front(*it);
-            newBuckets[index] = newElements.begin();
-          }
-          else
-          {
-            newElements.insert(newBuckets[index], *it);
-            --(newBuckets[index]);
-          }
-          ++it;
-          elements_.erase(temp);
-          temp = it;
+          elements_.splice(newBuckets[index], elements_, it);
         }
-        elements_ = std::move(newElements);
-        delete[] buckets_;
-        buckets_ = newBuckets;
-        capacity_ = newCapacity;
-      }
-      catch (...)
-      {
-        clear();
-        delete[] buckets_;
-        throw;
+        newBuckets[index] = it;
       }
+      delete[] buckets_;
+      buckets_ = newBuckets;
+      capacity_ = newCapacity;
     }
-    size_t calculateNextCapacity(size_t current) const
+    size_t calculateNextCapacity(size_t current) const noexcept
     {
-      size_t powDegree = 0;
-      for (; current > std::pow(2, powDegree); ++powDegree) {};
-      ++powDegree;
-      return std::pow(2, powDegree) - (std::pow(2, powDegree) - std::pow(2, powDegree - 1)) / 2 - 1;
+      size_t power = 1;
+      while (power < current)
+      {
+        power *= 2;
+      }
+      return power + power / 2 - 1;
     }
     hash_table_iterator find(const Key & key, size_t hash)
     {
@@ -324,51 +335,36 @@ namespace namestnikov
     }
     std::pair< hash_table_iterator, bool > insert(const Key & key, const Value & value, size_t hash)
     {
+      hash_table_iterator desired = find(key, hash);
+      if (desired != end())
+      {
+        return std::pair< hash_table_iterator, bool >(desired, false);
+      }
+      if (capacity_ < ((count_ + 1) / maxLoadFactor_))
+      {
+        rehash(calculateNextCapacity(capacity_));
+      }
+      size_t index = hash % capacity_;
+      node_t * node = new node_t(val_type_t(key, value), hash);
       try
       {
-        hash_table_iterator desired = find(key, hash);
-        if (desired != end())
+        if (buckets_[index] == elements_.end())
         {
-          return std::pair< hash_table_iterator, bool >(desired, false);
+          elements_.push_front(node);
+          buckets_[index] = elements_.begin();
         }
-        size_t index = hash % capacity_;
-        if (capacity_ < ((count_ + 1) / 0.75))
-        {
-          rehash(calculateNextCapacity(capacity_));
-          index = hash % capacity_;
-        }
-
-        node_t  * node = new node_t(val_type_t(key, value), hash);
-        std::pair< hash_table_iterator, bool > result(end(), true);
-        try
-        {
-          if (buckets_[index] == elements_.end())
-          {
-            elements_.push_front(node);
-            buckets_[index] = elements_.begin();
-            result.first = begin();
-          }
-          else
-          {
-            elements_.insert(buckets_[index], node);
-            --(buckets_[index]);
-            result.first = hash_table_iterator(buckets_[index]);
-          }
-        }
-        catch (...)
+        else
         {
-          delete node;
-          throw;
+          buckets_[index] = elements_.insert(buckets_[index], node);
         }
-        ++count_;
-        return result;
       }
       catch (...)
       {
-        clear();
-        delete[] buckets_;
+        delete node;
         throw;
       }
+      ++count_;
+      return std::pair< hash_table_iterator, bool >(hash_table_iterator(buckets_[index]), true);
     }
   };
 }
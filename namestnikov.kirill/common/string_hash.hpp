@@ -0,0 +1,34 @@
+#ifndef STRING_HASH_HPP
+#define STRING_HASH_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+
+namespace namestnikov
+{
+  struct StringHash
+  {
+    using is_transparent = void;
+    size_t operator()(const char * str) const noexcept
+    {
+      return hash(str, std::strlen(str));
+    }
+    size_t operator()(const std::string & str) const noexcept
+    {
+      return hash(str.data(), str.size());
+    }
+  private:
+    static size_t hash(const char * data, size_t size) noexcept
+    {
+      unsigned long long result = 14695981039346656037ull;
+      for (size_t i = 0; i < size; ++i)
+      {
+        result = (result ^ static_cast< unsigned char >(data[i])) * 1099511628211ull;
+      }
+      return static_cast< size_t >(result);
+    }
+  };
+}
+
+#endif
@@ -1,6 +1,7 @@
 #ifndef TREE_HPP
 #define TREE_HPP
 
+#include <algorithm>
 #include <functional>
 #include <type_traits>
 #include <cassert>
@@ -242,6 +243,18 @@ namespace namestnikov
     {
       return size_;
     }
+    Tree intersect(const Tree & other) const
+    {
+      return combine(other, false, true, false);
+    }
+    Tree unite(const Tree & other) const
+    {
+      return combine(other, true, true, true);
+    }
+    Tree complement(const Tree & other) const
+    {
+      return combine(other, true, false, false);
+    }
     bool empty() const noexcept
     {
       return (size_ == 0);
@@ -384,6 +397,97 @@ namespace namestnikov
       }
       return result;
     }
+    Tree combine(const Tree & other, bool takeLeft, bool takeBoth, bool takeRight) const
+    {
+      node_t * chain = nullptr;
+      node_t ** tail = std::addressof(chain);
+      size_t count = 0;
+      try
+      {
+        const_iterator left = cbegin();
+        const_iterator right = other.cbegin();
+        while ((left != cend()) && (right != other.cend()))
+        {
+          if (compare_(left->first, right->first))
+          {
+            if (takeLeft)
+            {
+              append_sorted(tail, count, left->first, left->second);
+            }
+            ++left;
+          }
+          else if (compare_(right->first, left->first))
+          {
+            if (takeRight)
+            {
+              append_sorted(tail, count, right->first, right->second);
+            }
+            ++right;
+          }
+          else
+          {
+            if (takeBoth)
+            {
+              append_sorted(tail, count, left->first, left->second);
+            }
+            ++left;
+            ++right;
+          }
+        }
+        for (; takeLeft && (left != cend()); ++left)
+        {
+          append_sorted(tail, count, left->first, left->second);
+        }
+        for (; takeRight && (right != other.cend()); ++right)
+        {
+          append_sorted(tail, count, right->first, right->second);
+        }
+      }
+      catch (...)
+      {
+        while (chain)
+        {
+          node_t * next = chain->right;
+          delete chain;
+          chain = next;
+        }
+        throw;
+      }
+      Tree result;
+      int height = 0;
+      result.root_ = build_sorted(chain, count, nullptr, height);
+      result.size_ = count;
+      return result;
+    }
+    static void append_sorted(node_t **& tail, size_t & count, const Key & key, const Value & val)
+    {
+      *tail = new node_t(key, val);
+      tail = std::addressof((*tail)->right);
+      ++count;
+    }
+    static node_t * build_sorted(node_t *& chain, size_t count, node_t * parent, int & height)
+    {
+      if (count == 0)
+      {
+        height = 0;
+        return nullptr;
+      }
+      int leftHeight = 0;
+      int rightHeight = 0;
+      node_t * leftChild = build_sorted(chain, (count - 1) / 2, nullptr, leftHeight);
+      node_t * node = chain;
+      chain = chain->right;
+      node->parent = parent;
+      node->left = leftChild;
+      if (leftChild)
+      {
+        leftChild->parent = node;
+      }
+      node->right = build_sorted(chain, count - 1 - (count - 1) / 2, node, rightHeight);
+      node->height = leftHeight - rightHeight;
+      height = std::max(leftHeight, rightHeight) + 1;
+      return node;
+    }
     node_t * rotateLeft(node_t * node)
     {
       node_t * newRoot = node->right;
@@ -26,14 +26,14 @@ void nikitov::printHelp(std::ostream& output)
     << "17. merge dictionary <firstDictName> <secondDictName> <newDictName> - creates a new dictionary based on the other two" << '\n';
 }
 
-void nikitov::printDictCmd(const Tree< std::string, Dictionary >& dictOfDicts, std::istream& input, std::ostream& output)
+void nikitov::printDictCmd(const DictionaryTree& dictOfDicts, std::istream& input, std::ostream& output)
 {
   std::string dictName;
   input >> dictName;
   output << dictOfDicts.at(dictName);
 }
 
-void nikitov::printAllCmd(const Tree< std::string, Dictionary >& dictOfDicts, std::istream&, std::ostream& output)
+void nikitov::printAllCmd(const DictionaryTree& dictOfDicts, std::istream&, std::ostream& output)
 {
   for (auto i = dictOfDicts.cbegin(); i != dictOfDicts.cend(); ++i)
   {
@@ -41,7 +41,7 @@ void nikitov::printAllCmd(const Tree< std::string, Dictionary >& dictOfDicts, st
   }
 }
 
-void nikitov::printNamesCmd(const Tree< std::string, Dictionary >& dictOfDicts, std::istream&, std::ostream& output)
+void nikitov::printNamesCmd(const DictionaryTree& dictOfDicts, std::istream&, std::ostream& output)
 {
   for (auto i = dictOfDicts.cbegin(); i != dictOfDicts.cend(); ++i)
   {
@@ -49,7 +49,7 @@ void nikitov::printNamesCmd(const Tree< std::string, Dictionary >& dictOfDicts,
   }
 }
 
-void nikitov::findCmd(const Tree< std::string, Dictionary >& dictOfDicts, std::istream& input, std::ostream& output,
+void nikitov::findCmd(const DictionaryTree& dictOfDicts, std::istream& input, std::ostream& output,
   const std::string& parameter)
 {
   std::string dictionaryName;
@@ -66,7 +66,7 @@ void nikitov::findCmd(const Tree< std::string, Dictionary >& dictOfDicts, std::i
   }
 }
 
-char translate(const nikitov::Tree< std::string, nikitov::Dictionary >& dictOfDicts, const std::string& dictionaryName,
+char translate(const nikitov::DictionaryTree& dictOfDicts, const std::string& dictionaryName,
   std::istream& input, std::ostream& output)
 {
   std::string line;
@@ -100,7 +100,7 @@ char translate(const nikitov::Tree< std::string, nikitov::Dictionary >& dictOfDi
   return symb;
 }
 
-void nikitov::translateSentenceCmd(const Tree< std::string, Dictionary >& dictOfDicts, std::istream& input, std::ostream& output)
+void nikitov::translateSentenceCmd(const DictionaryTree& dictOfDicts, std::istream& input, std::ostream& output)
 {
   std::string dictionaryName;
   input >> dictionaryName;
@@ -119,7 +119,7 @@ void nikitov::translateSentenceCmd(const Tree< std::string, Dictionary >& dictOf
   output << '\n';
 }
 
-void nikitov::translateFileCmd(const Tree< std::string, Dictionary >& dictOfDicts, std::istream& input, std::ostream&)
+void nikitov::translateFileCmd(const DictionaryTree& dictOfDicts, std::istream& input, std::ostream&)
 {
   std::string dictionaryName;
   input >> dictionaryName;
@@ -144,7 +144,7 @@ void nikitov::translateFileCmd(const Tree< std::string, Dictionary >& dictOfDict
   fileOutput << '\n';
 }
 
-void nikitov::saveCmd(const Tree< std::string, Dictionary >& dictOfDicts, std::istream& input, std::ostream&)
+void nikitov::saveCmd(const DictionaryTree& dictOfDicts, std::istream& input, std::ostream&)
 {
   std::string dictName;
   input >> dictName;
@@ -154,7 +154,7 @@ void nikitov::saveCmd(const Tree< std::string, Dictionary >& dictOfDicts, std::i
   fileOutput << dictOfDicts.at(dictName);
 }
 
-void nikitov::createCmd(Tree< std::string, Dictionary >& dictOfDicts, std::istream& input)
+void nikitov::createCmd(DictionaryTree& dictOfDicts, std::istream& input)
 {
   std::string dictionaryName;
   input >> dictionaryName;
@@ -164,7 +164,7 @@ void nikitov::createCmd(Tree< std::string, Dictionary >& dictOfDicts, std::istre
   }
 }
 
-void nikitov::addCmd(Tree< std::string, Dictionary >& dictOfDicts, std::istream& input, const std::string& parameter)
+void nikitov::addCmd(DictionaryTree& dictOfDicts, std::istream& input, const std::string& parameter)
 {
   std::string dictionaryName;
   input >> dictionaryName;
@@ -181,7 +181,7 @@ void nikitov::addCmd(Tree< std::string, Dictionary >& dictOfDicts, std::istream&
   }
 }
 
-void nikitov::editCmd(Tree< std::string, Dictionary >& dictOfDicts, std::istream& input, const std::string& parameter)
+void nikitov::editCmd(DictionaryTree& dictOfDicts, std::istream& input, const std::string& parameter)
 {
   std::string dictionaryName;
   input >> dictionaryName;
@@ -199,7 +199,7 @@ void nikitov::editCmd(Tree< std::string, Dictionary >& dictOfDicts, std::istream
   }
 }
 
-void nikitov::deleteCmd(Tree< std::string, Dictionary >& dictOfDicts, std::istream& input, const std::string& parameter)
+void nikitov::deleteCmd(DictionaryTree& dictOfDicts, std::istream& input, const std::string& parameter)
 {
   std::string dictionaryName;
   input >> dictionaryName;
@@ -219,17 +219,17 @@ void nikitov::deleteCmd(Tree< std::string, Dictionary >& dictOfDicts, std::istre
   }
 }
 
-void nikitov::mergeCmd(Tree< std::string, Dictionary >& dictOfDicts, std::istream& input)
+void nikitov::mergeCmd(DictionaryTree& dictOfDicts, std::istream& input)
 {
   std::string firstDictionaryName;
   input >> firstDictionaryName;
-  auto firstDict = dictOfDicts.at(firstDictionaryName);
+  const Dictionary& firstDict = dictOfDicts.at(firstDictionaryName);
   std::string secondDictionaryName;
   input >> secondDictionaryName;
-  auto secondDict = dictOfDicts.at(secondDictionaryName);
+  const Dictionary& secondDict = dictOfDicts.at(secondDictionaryName);
   std::string newDictionaryName;
   input >> newDictionaryName;
-  auto newDict = firstDict;
+  Dictionary newDict = firstDict;
   for (auto i = secondDict.data_.cbegin(); i != secondDict.data_.cend(); ++i)
   {
     newDict.data_.insert(*i);
@@ -8,19 +8,19 @@ namespace nikitov
 {
   void printHelp(std::ostream& output);
 
-  void printDictCmd(const Tree< std::string, Dictionary >& dictOfDicts, std::istream& input, std::ostream& output);
-  void printAllCmd(const Tree< std::string, Dictionary >& dictOfDicts, std::istream& input, std::ostream& output);
-  void printNamesCmd(const Tree< std::string, Dictionary >& dictOfDicts, std::istream&, std::ostream& output);
-  void findCmd(const Tree< std::string, Dictionary >& dictOfDicts, std::istream& input, std::ostream& output,
+  void printDictCmd(const DictionaryTree& dictOfDicts, std::istream& input, std::ostream& output);
+  void printAllCmd(const DictionaryTree& dictOfDicts, std::istream& input, std::ostream& output);
+  void printNamesCmd(const DictionaryTree& dictOfDicts, std::istream&, std::ostream& output);
+  void findCmd(const DictionaryTree& dictOfDicts, std::istream& input, std::ostream& output,
     const std::string& parameter);
-  void translateSentenceCmd(const Tree< std::string, Dictionary >& dictOfDicts, std::istream& input, std::ostream& output);
-  void translateFileCmd(const Tree< std::string, Dictionary >& dictOfDicts, std::istream& input, std::ostream& output);
-  void saveCmd(const Tree< std::string, Dictionary >& dictOfDicts, std::istream& input, std::ostream&);
+  void translateSentenceCmd(const DictionaryTree& dictOfDicts, std::istream& input, std::ostream& output);
+  void translateFileCmd(const DictionaryTree& dictOfDicts, std::istream& input, std::ostream& output);
+  void saveCmd(const DictionaryTree& dictOfDicts, std::istream& input, std::ostream&);
 
-  void createCmd(Tree< std::string, Dictionary >& dictOfDicts, std::istream& input);
-  void addCmd(Tree< std::string, Dictionary >& dictOfDicts, std::istream& input, const std::string& parameter);
-  void editCmd(Tree< std::string, Dictionary >& dictOfDicts, std::istream& input, const std::string& parameter);
-  void deleteCmd(Tree< std::string, Dictionary >& dictOfDicts, std::istream& input, const std::string& parameter);
-  void mergeCmd(Tree< std::string, Dictionary >& dictOfDicts, std::istream& input);
+  void createCmd(DictionaryTree& dictOfDicts, std::istream& input);
+  void addCmd(DictionaryTree& dictOfDicts, std::istream& input, const std::string& parameter);
+  void editCmd(DictionaryTree& dictOfDicts, std::istream& input, const std::string& parameter);
+  void deleteCmd(DictionaryTree& dictOfDicts, std::istream& input, const std::string& parameter);
+  void mergeCmd(DictionaryTree& dictOfDicts, std::istream& input);
 }
 #endif
@@ -2,11 +2,15 @@
 #define DICTIONARY_HPP
 
 #include <iostream>
+#include <functional>
 #include <tree.hpp>
 #include "word.hpp"
 
 namespace nikitov
 {
+  class Dictionary;
+  typedef Tree< std::string, Dictionary, std::less<> > DictionaryTree;
+
   class Dictionary
   {
   public:
@@ -28,10 +32,10 @@ namespace nikitov
 
     friend std::istream& operator>>(std::istream& input, Dictionary& dict);
     friend std::ostream& operator<<(std::ostream& output, const Dictionary& dict);
-    friend void mergeCmd(Tree< std::string, Dictionary >& dictOfDicts, std::istream& input);
+    friend void mergeCmd(DictionaryTree& dictOfDicts, std::istream& input);
 
   private:
-    Tree< std::string, detail::Word > data_;
+    Tree< std::string, detail::Word, std::less<> > data_;
   };
 
   std::istream& operator>>(std::istream& input, Dictionary& dict);
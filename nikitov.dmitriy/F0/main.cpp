@@ -10,7 +10,7 @@ int main(int argc, char* argv[])
 {
   using namespace nikitov;
 
-  Tree< std::string, Dictionary > dictOfDicts;
+  DictionaryTree dictOfDicts;
   if (argc != 1)
   {
     if (std::string(argv[1]) == "--dicts")
@@ -34,7 +34,7 @@ int main(int argc, char* argv[])
   }
 
   using namespace std::placeholders;
-  Tree< std::pair< std::string, std::string >, std::function< void(const Tree< std::string, Dictionary >&, std::istream&,
+  Tree< std::pair< std::string, std::string >, std::function< void(const DictionaryTree&, std::istream&,
     std::ostream&) > > constCommands;
   constCommands[{ "print", "dictionary" }] = printDictCmd;
   constCommands[{ "print", "all" }] = printAllCmd;
@@ -45,7 +45,7 @@ int main(int argc, char* argv[])
   constCommands[{ "translate", "file" }] = translateFileCmd;
   constCommands[{ "save", "dictionary" }] = saveCmd;
 
-  Tree< std::pair< std::string, std::string >, std::function< void(Tree< std::string, Dictionary >&, std::istream&) > > commands;
+  Tree< std::pair< std::string, std::string >, std::function< void(DictionaryTree&, std::istream&) > > commands;
   commands[{ "create", "dictionary" }] = createCmd;
   commands[{ "add", "translation" }] = std::bind(addCmd, _1, _2, "translation");
   commands[{ "add", "antonym" }] = std::bind(addCmd, _1, _2, "antonym");
@@ -23,6 +23,8 @@ namespace nikitov
   class ConstTreeIterator: public std::iterator< std::bidirectional_iterator_tag, T >
   {
     friend class Tree< Key, T, Compare >;
+    friend class LNRIterator< Key, T, Compare >;
+    friend class RNLIterator< Key, T, Compare >;
   public:
     ConstTreeIterator(const ConstTreeIterator< Key, T, Compare >&) = default;
     ConstTreeIterator(const LNRIterator< Key, T, Compare >& other);
@@ -64,13 +66,13 @@ namespace nikitov
 
   template< class Key, class T, class Compare >
   ConstTreeIterator< Key, T, Compare >::ConstTreeIterator(const LNRIterator< Key, T, Compare >& other):
-    node_(other.data_.top()),
+    node_(other.node_),
     isFirst_(other.isFirst_)
   {}
 
   template< class Key, class T, class Compare >
   ConstTreeIterator< Key, T, Compare >::ConstTreeIterator(const RNLIterator< Key, T, Compare >& other):
-    node_(other.iterator_.data_.top()),
+    node_(other.node_),
     isFirst_(other.isFirst_)
   {}
 
@@ -83,15 +85,17 @@ namespace nikitov
   template< class Key, class T, class Compare >
   ConstTreeIterator< Key, T, Compare >& ConstTreeIterator< Key, T, Compare >::operator=(const LNRIterator< Key, T, Compare >& other)
   {
-    node_ = other.data_.top();
+    node_ = other.node_;
     isFirst_ = other.isFirst_;
+    return *this;
   }
 
   template< class Key, class T, class Compare >
   ConstTreeIterator< Key, T, Compare >& ConstTreeIterator< Key, T, Compare >::operator=(const RNLIterator< Key, T, Compare >& other)
   {
-    node_ = other.iterator_.data_.top();
+    node_ = other.node_;
     isFirst_ = other.isFirst_;
+    return *this;
   }
 
   template< class Key, class T, class Compare >
@@ -5,6 +5,7 @@
 #include <stack.hpp>
 #include <queue.hpp>
 #include <tree_node.hpp>
+#include "const_tree_iterator.hpp"
 
 namespace nikitov
 {
@@ -14,11 +15,14 @@ namespace nikitov
   template< class Key, class T, class Compare >
   class RNLIterator;
 
+  template< class Key, class T, class Compare >
+  class ConstTreeIterator;
+
   template< class Key, class T, class Compare = std::less< Key > >
   class LNRIterator: public std::iterator< std::bidirectional_iterator_tag, T >
   {
     friend class Tree< Key, T, Compare >;
-    friend class RNLIterator< Key, T, Compare >;
+    friend class ConstTreeIterator< Key, T, Compare >;
   public:
     LNRIterator(const LNRIterator< Key, T, Compare >&) = default;
     ~LNRIterator() = default;
@@ -37,94 +41,25 @@ namespace nikitov
     bool operator!=(const LNRIterator< Key, T, Compare >& other) const;
 
   private:
-    Stack< detail::TreeNode< Key, T, Compare >* > data_;
+    detail::TreeNode< Key, T, Compare >* node_;
     bool isFirst_;
 
-    explicit LNRIterator(detail::TreeNode< Key, T, Compare >* root, detail::TreeNode< Key, T, Compare >* node, bool isFirst = true);
+    explicit LNRIterator(const ConstTreeIterator< Key, T, Compare >& iterator);
   };
 
   template< class Key, class T, class Compare >
-  LNRIterator< Key, T, Compare >::LNRIterator(detail::TreeNode< Key, T, Compare >* root,
-    detail::TreeNode< Key, T, Compare >* node, bool isFirst):
-    data_(),
-    isFirst_(isFirst)
-  {
-    data_.push(root);
-    Compare cmp;
-    while (root != node)
-    {
-      if (root->size_ == 0)
-      {
-        root = root->middle_;
-      }
-      else if (cmp(node->firstValue_.first, root->firstValue_.first))
-      {
-        root = root->left_;
-      }
-      else if (root->size_ == 1 || cmp(root->secondValue_.first, node->firstValue_.first))
-      {
-        root = root->right_;
-      }
-      else
-      {
-        root = root->middle_;
-      }
-      data_.push(root);
-    }
-  }
+  LNRIterator< Key, T, Compare >::LNRIterator(const ConstTreeIterator< Key, T, Compare >& iterator):
+    node_(iterator.node_),
+    isFirst_(iterator.isFirst_)
+  {}
 
   template< class Key, class T, class Compare >
   LNRIterator< Key, T, Compare >& LNRIterator< Key, T, Compare >::operator++()
   {
-    detail::TreeNode< Key, T, Compare >* node = data_.top();
-    if (node->size_ == 1 || !isFirst_)
-    {
-      if (node->right_)
-      {
-        node = node->right_;
-        data_.push(node);
-        while (node->left_)
-        {
-          node = node->left_;
-          data_.push(node);
-        }
-        isFirst_ = true;
-      }
-      else
-      {
-        isFirst_ = true;
-        data_.pop();
-        detail::TreeNode< Key, T, Compare >* parent = data_.top();
-        while (parent->right_ == node)
-        {
-          node = parent;
-          data_.pop();
-          parent = data_.top();
-        }
-        if (parent->middle_ == node && data_.size() != 1)
-        {
-          isFirst_ = false;
-        }
-      }
-    }
-    else
-    {
-      if (node->middle_)
-      {
-        node = node->middle_;
-        data_.push(node);
-        while (node->left_)
-        {
-          node = node->left_;
-          data_.push(node);
-        }
-        isFirst_ = true;
-      }
-      else
-      {
-        isFirst_ = false;
-      }
-    }
+    ConstTreeIterator< Key, T, Compare > iterator(node_, isFirst_);
+    ++iterator;
+    node_ = iterator.node_;
+    isFirst_ = iterator.isFirst_;
     return *this;
   }
 
@@ -139,91 +74,10 @@ namespace nikitov
   template< class Key, class T, class Compare >
   LNRIterator< Key, T, Compare >& LNRIterator< Key, T, Compare >::operator--()
   {
-    detail::TreeNode< Key, T, Compare >* node = data_.top();
-    if (data_.size() == 1)
-    {
-      node = node->middle_;
-      data_.push(node);
-      while (node->right_)
-      {
-        node = node->right_;
-        data_.push(node);
-      }
-      if (node->size_ == 2)
-      {
-        isFirst_ = false;
-      }
-      else
-      {
-        isFirst_ = true;
-      }
-    }
-    else if (node->size_ == 1 || isFirst_)
-    {
-      if (node->left_)
-      {
-        node = node->left_;
-        data_.push(node);
-        while (node->right_)
-        {
-          node = node->right_;
-          data_.push(node);
-        }
-        if (node->size_ == 2)
-        {
-          isFirst_ = false;
-        }
-        else
-        {
-          isFirst_ = true;
-        }
-      }
-      else
-      {
-        isFirst_ = true;
-        data_.pop();
-        detail::TreeNode< Key, T, Compare >* parent = data_.top();
-        while (parent->left_ == node)
-        {
-          node = parent;
-          data_.pop();
-          parent = data_.top();
-        }
-        if (parent->size_ == 2)
-        {
-          isFirst_ = false;
-        }
-        if (parent->middle_ == node)
-        {
-          isFirst_ = true;
-        }
-      }
-    }
-    else
-    {
-      if (node->middle_)
-      {
-        node = node->middle_;
-        data_.push(node);
-        while (node->right_)
-        {
-          node = node->right_;
-          data_.push(node);
-        }
-        if (node->size_ == 2)
-        {
-          isFirst_ = false;
-        }
-        else
-        {
-          isFirst_ = true;
-        }
-      }
-      else
-      {
-        isFirst_ = true;
-      }
-    }
+    ConstTreeIterator< Key, T, Compare > iterator(node_, isFirst_);
+    --iterator;
+    node_ = iterator.node_;
+    isFirst_ = iterator.isFirst_;
     return *this;
   }
 
@@ -238,49 +92,40 @@ namespace nikitov
   template< class Key, class T, class Compare >
   const std::pair< Key, T >& LNRIterator< Key, T, Compare >::operator*() const
   {
-    detail::TreeNode< Key, T, Compare >* node = data_.top();
-    assert(node->size_ != 0);
+    assert(node_->size_ != 0);
     if (isFirst_)
     {
-      return node->firstValue_;
+      return node_->firstValue_;
     }
     else
     {
-      return node->secondValue_;
+      return node_->secondValue_;
     }
   }
 
   template< class Key, class T, class Compare >
   const std::pair< Key, T >* LNRIterator< Key, T, Compare >::operator->() const
   {
-    detail::TreeNode< Key, T, Compare >* node = data_.top();
-    assert(node->size_ != 0);
-    if (isFirst_)
-    {
-      return std::addressof(node->firstValue_);
-    }
-    else
-    {
-      return std::addressof(node->secondValue_);
-    }
+    return std::addressof(**this);
   }
 
   template< class Key, class T, class Compare >
   bool LNRIterator< Key, T, Compare >::operator==(const LNRIterator< Key, T, Compare >& other) const
   {
-    return (isFirst_ == other.isFirst_) && (data_.top() == other.data_.top());
+    return (isFirst_ == other.isFirst_) && (node_ == other.node_);
   }
 
   template< class Key, class T, class Compare >
   bool LNRIterator< Key, T, Compare >::operator!=(const LNRIterator< Key, T, Compare >& other) const
   {
-    return (isFirst_ != other.isFirst_) || (data_.top() != other.data_.top());
+    return (isFirst_ != other.isFirst_) || (node_ != other.node_);
   }
 
   template< class Key, class T, class Compare = std::less< Key > >
   class RNLIterator: public std::iterator< std::bidirectional_iterator_tag, T >
   {
     friend class Tree< Key, T, Compare >;
+    friend class ConstTreeIterator< Key, T, Compare >;
   public:
     RNLIterator(const RNLIterator< Key, T, Compare >&) = default;
     ~RNLIterator() = default;
@@ -299,21 +144,25 @@ namespace nikitov
     bool operator!=(const RNLIterator< Key, T, Compare >& other) const;
 
   private:
-    LNRIterator< Key, T, Compare > iterator_;
+    detail::TreeNode< Key, T, Compare >* node_;
+    bool isFirst_;
 
-    explicit RNLIterator(detail::TreeNode< Key, T, Compare >* root, detail::TreeNode< Key, T, Compare >* node, bool isFirst = true);
+    explicit RNLIterator(const ConstTreeIterator< Key, T, Compare >& iterator);
   };
 
   template< class Key, class T, class Compare >
-  RNLIterator< Key, T, Compare >::RNLIterator(detail::TreeNode< Key, T, Compare >* root,
-    detail::TreeNode< Key, T, Compare >* node, bool isFirst):
-    iterator_(root, node, isFirst)
+  RNLIterator< Key, T, Compare >::RNLIterator(const ConstTreeIterator< Key, T, Compare >& iterator):
+    node_(iterator.node_),
+    isFirst_(iterator.isFirst_)
   {}
 
   template< class Key, class T, class Compare >
   RNLIterator< Key, T, Compare >& RNLIterator< Key, T, Compare >::operator++()
   {
-    --iterator_;
+    ConstTreeIterator< Key, T, Compare > iterator(node_, isFirst_);
+    --iterator;
+    node_ = iterator.node_;
+    isFirst_ = iterator.isFirst_;
     return *this;
   }
 
@@ -328,7 +177,10 @@ namespace nikitov
   template< class Key, class T, class Compare >
   RNLIterator< Key, T, Compare >& RNLIterator< Key, T, Compare >::operator--()
   {
-    ++iterator_;
+    ConstTreeIterator< Key, T, Compare > iterator(node_, isFirst_);
+    ++iterator;
+    node_ = iterator.node_;
+    isFirst_ = iterator.isFirst_;
     return *this;
   }
 
@@ -343,25 +195,33 @@ namespace nikitov
   template< class Key, class T, class Compare >
   const std::pair< Key, T >& RNLIterator< Key, T, Compare >::operator*() const
   {
-    return *iterator_;
+    assert(node_->size_ != 0);
+    if (isFirst_)
+    {
+      return node_->firstValue_;
+    }
+    else
+    {
+      return node_->secondValue_;
+    }
   }
 
   template< class Key, class T, class Compare >
   const std::pair< Key, T >* RNLIterator< Key, T, Compare >::operator->() const
   {
-    return iterator_.operator->();
+    return std::addressof(**this);
   }
 
   template< class Key, class T, class Compare >
   bool RNLIterator< Key, T, Compare >::operator==(const RNLIterator< Key, T, Compare >& other) const
   {
-    return iterator_ == other.iterator_;
+    return (isFirst_ == other.isFirst_) && (node_ == other.node_);
   }
 
   template< class Key, class T, class Compare >
   bool RNLIterator< Key, T, Compare >::operator!=(const RNLIterator< Key, T, Compare >& other) const
   {
-    return iterator_ != other.iterator_;
+    return (isFirst_ != other.isFirst_) || (node_ != other.node_);
   }
 
   template< class Key, class T, class Compare = std::less< Key > >
@@ -66,6 +66,16 @@ namespace nikitov
     size_t count(const Key& key) const;
     treeIterator find(const Key& key) noexcept;
     constTreeIterator find(const Key& key) const noexcept;
+    template< class K, class C = Compare, class = typename C::is_transparent >
+    size_t count(const K& key) const;
+    template< class K, class C = Compare, class = typename C::is_transparent >
+    treeIterator find(const K& key) noexcept;
+    template< class K, class C = Compare, class = typename C::is_transparent >
+    constTreeIterator find(const K& key) const noexcept;
+    template< class K, class C = Compare, class = typename C::is_transparent >
+    T& at(const K& key);
+    template< class K, class C = Compare, class = typename C::is_transparent >
+    const T& at(const K& key) const;
 
     treeIterator lowerBound(const Key& key);
     constTreeIterator lowerBound(const Key& key) const;
@@ -92,7 +102,8 @@ namespace nikitov
     size_t size_;
     Compare cmp_;
 
-    detail::TreeNode< Key, T, Compare >* search(detail::TreeNode< Key, T, Compare >* node, const Key& key) const;
+    template< class K >
+    detail::TreeNode< Key, T, Compare >* search(detail::TreeNode< Key, T, Compare >* node, const K& key) const;
     detail::TreeNode< Key, T, Compare >* findToInsert(const Key& value) const;
 
     std::pair< TreeIterator< Key, T, Compare >, bool > embed(const std::pair< Key, T >& value);
@@ -255,25 +266,25 @@ namespace nikitov
   template< class Key, class T, class Compare >
   LNRIterator< Key, T, Compare > Tree< Key, T, Compare >::LNRCbegin() const noexcept
   {
-    return LNRIterator< Key, T, Compare >(cend().node_, cbegin().node_);
+    return LNRIterator< Key, T, Compare >(cbegin());
   }
 
   template< class Key, class T, class Compare >
   LNRIterator< Key, T, Compare > Tree< Key, T, Compare >::LNRCend() const noexcept
   {
-    return LNRIterator< Key, T, Compare >(cend().node_, cend().node_);
+    return LNRIterator< Key, T, Compare >(cend());
   }
 
   template< class Key, class T, class Compare >
   RNLIterator< Key, T, Compare > Tree< Key, T, Compare >::RNLCbegin() const noexcept
   {
-    return RNLIterator< Key, T, Compare >(cend().node_, (--cend()).node_);
+    return RNLIterator< Key, T, Compare >(--cend());
   }
 
   template< class Key, class T, class Compare >
   RNLIterator< Key, T, Compare > Tree< Key, T, Compare >::RNLCend() const noexcept
   {
-    return RNLIterator< Key, T, Compare >(cend().node_, cend().node_);
+    return RNLIterator< Key, T, Compare >(cend());
   }
 
   template< class Key, class T, class Compare >
@@ -470,6 +481,61 @@ namespace nikitov
     return cend();
   }
 
+  template< class Key, class T, class Compare >
+  template< class K, class C, class >
+  size_t Tree< Key, T, Compare >::count(const K& key) const
+  {
+    return search(root_, key) != nullptr;
+  }
+
+  template< class Key, class T, class Compare >
+  template< class K, class C, class >
+  TreeIterator< Key, T, Compare > Tree< Key, T, Compare >::find(const K& key) noexcept
+  {
+    detail::TreeNode< Key, T, Compare >* node = search(root_, key);
+    if (node)
+    {
+      return treeIterator(node, node->firstValue_.first == key);
+    }
+    return end();
+  }
+
+  template< class Key, class T, class Compare >
+  template< class K, class C, class >
+  ConstTreeIterator< Key, T, Compare > Tree< Key, T, Compare >::find(const K& key) const noexcept
+  {
+    detail::TreeNode< Key, T, Compare >* node = search(root_, key);
+    if (node)
+    {
+      return constTreeIterator(node, node->firstValue_.first == key);
+    }
+    return cend();
+  }
+
+  template< class Key, class T, class Compare >
+  template< class K, class C, class >
+  T& Tree< Key, T, Compare >::at(const K& key)
+  {
+    detail::TreeNode< Key, T, Compare >* node = search(root_, key);
+    if (!node)
+    {
+      throw std::out_of_range("Error: No element by key");
+    }
+    return node->get(key);
+  }
+
+  template< class Key, class T, class Compare >
+  template< class K, class C, class >
+  const T& Tree< Key, T, Compare >::at(const K& key) const
+  {
+    detail::TreeNode< Key, T, Compare >* node = search(root_, key);
+    if (!node)
+    {
+      throw std::out_of_range("Error: No element by key");
+    }
+    return node->get(key);
+  }
+
   template< class Key, class T, class Compare >
   TreeIterator< Key, T, Compare > Tree< Key, T, Compare >::lowerBound(const Key& key)
   {
@@ -603,8 +669,9 @@ namespace nikitov
   }
 
   template< class Key, class T, class Compare >
+  template< class K >
   detail::TreeNode< Key, T, Compare >* Tree< Key, T, Compare >::search(detail::TreeNode< Key, T, Compare >* node,
-    const Key& key) const
+    const K& key) const
   {
     if (!node)
     {
@@ -40,9 +40,12 @@ namespace nikitov
       explicit TreeNode(const std::pair< Key, T >& value);
       ~TreeNode() = default;
 
-      bool find(const Key& key) const;
-      T& get(const Key& key);
-      const T& get(const Key& key) const;
+      template< class K >
+      bool find(const K& key) const;
+      template< class K >
+      T& get(const K& key);
+      template< class K >
+      const T& get(const K& key) const;
 
       treeNode* add(const std::pair< Key, T >& value);
       treeNode* moveAdd(std::pair< Key, T >&& value);
@@ -88,13 +91,15 @@ namespace nikitov
     }
 
     template< class Key, class T, class Compare >
-    bool TreeNode< Key, T, Compare >::find(const Key& key) const
+    template< class K >
+    bool TreeNode< Key, T, Compare >::find(const K& key) const
     {
       return firstValue_.first == key || (size_ == 2 && secondValue_.first == key);
     }
 
     template< class Key, class T, class Compare >
-    T& TreeNode< Key, T, Compare >::get(const Key& key)
+    template< class K >
+    T& TreeNode< Key, T, Compare >::get(const K& key)
     {
       if (size_ == 2 && secondValue_.first == key)
       {
@@ -104,7 +109,8 @@ namespace nikitov
     }
 
     template< class Key, class T, class Compare >
-    const T& TreeNode< Key, T, Compare >::get(const Key& key) const
+    template< class K >
+    const T& TreeNode< Key, T, Compare >::get(const K& key) const
     {
       if (size_ == 2 && secondValue_.first == key)
       {
@@ -4,7 +4,9 @@
 #include <list>
 #include <deque>
 #include <algorithm>
+#include <iterator>
 #include <stdexcept>
+#include <vector>
 #include "outputInput.hpp"
 
 namespace sivkov
@@ -61,32 +63,60 @@ namespace sivkov
     }
   }
 
+  inline std::vector< size_t > getShellGaps(size_t size)
+  {
+    const size_t ciuraGaps[] = { 1, 4, 10, 23, 57, 132, 301, 701, 1750 };
+    std::vector< size_t > gaps;
+    for (size_t gap : ciuraGaps)
+    {
+      if (gap >= size && !gaps.empty())
+      {
+        return gaps;
+      }
+      gaps.push_back(gap);
+    }
+    while (gaps.back() * 9 / 4 < size)
+    {
+      gaps.push_back(gaps.back() * 9 / 4);
+    }
+    return gaps;
+  }
+
   template < typename RandomIt, typename Compare >
-  void shellSort(RandomIt first, RandomIt last, Compare comp)
+  void shellSort(RandomIt first, RandomIt last, Compare comp, std::random_access_iterator_tag)
   {
-    auto n = std::distance(first, last);
-    for (auto gap = n / 2; gap > 0; gap /= 2)
+    size_t n = std::distance(first, last);
+    std::vector< size_t > gaps = getShellGaps(n);
+    for (auto gap = gaps.crbegin(); gap != gaps.crend(); ++gap)
     {
-      for (auto i = first; std::distance(first, i) < n; ++i)
+      for (size_t i = *gap; i < n; ++i)
       {
-        auto tempIt = i;
-        for (auto j = tempIt; std::distance(first, j) >= gap; std::advance(j, -gap))
+        auto temp = std::move(first[i]);
+        size_t j = i;
+        for (; j >= *gap && comp(temp, first[j - *gap]); j -= *gap)
         {
-          auto prevGapIt = j;
-          std::advance(prevGapIt, -gap);
-          if (comp(*tempIt, *prevGapIt))
-          {
-            std::swap(*tempIt, *prevGapIt);
-            tempIt = prevGapIt;
-          }
-          else
-          {
-            break;
-          }
+          first[j] = std::move(first[j - *gap]);
         }
+        first[j] = std::move(temp);
       }
     }
   }
+
+  template < typename ForwardIt, typename Compare >
+  void shellSort(ForwardIt first, ForwardIt last, Compare comp, std::forward_iterator_tag)
+  {
+    using T = typename std::iterator_traits< ForwardIt >::value_type;
+    std::vector< T > buffer(std::make_move_iterator(first), std::make_move_iterator(last));
+    shellSort(buffer.begin(), buffer.end(), comp, std::random_access_iterator_tag());
+    std::move(buffer.begin(), buffer.end(), first);
+  }
+
+  template < typename Iterator, typename Compare >
+  void shellSort(Iterator first, Iterator last, Compare comp)
+  {
+    shellSort(first, last, comp, typename std::iterator_traits< Iterator >::iterator_category());
+  }
+
   template< typename T >
   void enterTypeOfSort(const std::string& type, std::deque< T >& deq, List< T >& fwdList, std::list< T >& biList, std::ostream& out)
   {
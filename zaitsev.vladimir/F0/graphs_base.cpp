@@ -1,5 +1,10 @@
 #include "graphs_base.hpp"
 
+zaitsev::graph_t::allocator_type zaitsev::newGraphAllocator()
+{
+  return graph_t::allocator_type(std::make_shared< Arena >());
+}
+
 void zaitsev::createGraph(base_t& graphs, const args_flist& args, std::ostream&)
 {
   size_t args_nmb = std::distance(args.cbegin(), args.cend());
@@ -12,7 +17,7 @@ void zaitsev::createGraph(base_t& graphs, const args_flist& args, std::ostream&)
   {
     throw std::invalid_argument("Graph with name \"" + arg + "\", already exists.");
   }
-  graphs[arg];
+  graphs[arg] = graph_t(newGraphAllocator());
 }
 
 void zaitsev::deleteGraph(base_t& graphs, const args_flist& args, std::ostream&)
@@ -132,7 +137,7 @@ void zaitsev::mergeGraphs(base_t& graphs, const args_flist& args, std::ostream&)
   {
     throw std::invalid_argument("Invalid arguments");
   }
-  graph_t new_graph = graphs.find(nm_2)->second;
+  graph_t new_graph(graphs.find(nm_2)->second, newGraphAllocator());
   const graph_t& graph_1_inst = graphs.find(nm_1)->second;
 
   for (auto& i : graph_1_inst)
@@ -3,14 +3,18 @@
 #include <ostream>
 #include <string>
 #include <map.hpp>
+#include <arena.hpp>
 
 namespace zaitsev
 {
   using args_flist = ForwardList< std::string >;
-  using unit_t = Map< std::string, int >;
-  using graph_t = Map< std::string, unit_t >;
+  template< typename T >
+  using graph_alloc_t = ArenaAllocator< std::pair< const std::string, T > >;
+  using unit_t = Map< std::string, int, std::less< std::string >, graph_alloc_t< int > >;
+  using graph_t = Map< std::string, unit_t, std::less< std::string >, graph_alloc_t< unit_t > >;
   using base_t = Map < std::string, graph_t >;
 
+  graph_t::allocator_type newGraphAllocator();
   void createGraph(base_t& graphs, const args_flist& args, std::ostream&);
   void deleteGraph(base_t& graphs, const args_flist& args, std::ostream&);
   void addVertex(base_t& graphs, const args_flist& args, std::ostream&);
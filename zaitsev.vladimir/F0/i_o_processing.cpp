@@ -211,7 +211,7 @@ zaitsev::graph_t basicGraphRead(std::istream& in)
   using namespace zaitsev;
   using del = Delimiter;
   size_t vertices_nmb = 0;
-  graph_t new_graph;
+  graph_t new_graph(newGraphAllocator());
   in >> del{ "Vertices" } >> del{ "(" } >> vertices_nmb >> del{ "):" };
   for (size_t i = 0; i < vertices_nmb; ++i)
   {
@@ -45,6 +45,7 @@ namespace zaitsev
     detail::execute< dq, Compare >(out, vals.cbegin(), vals.cend(), std::sort< typename dq::iterator, Compare >);
     detail::execute< dq, Compare >(out, vals.cbegin(), vals.cend(), shellSort< typename dq::iterator, Compare >);
     detail::execute< dq, Compare >(out, vals.cbegin(), vals.cend(), binded_bucketsort);
+    detail::execute< dq, Compare >(out, vals.cbegin(), vals.cend(), radixSort< typename dq::iterator, Compare >);
     detail::execute< lst, Compare >(out, vals.cbegin(), vals.cend(), shellSort< typename lst::iterator, Compare >);
     detail::execute< Flist, Compare >(out, vals.cbegin(), vals.cend(), shellSort< typename Flist::iterator, Compare >);
     Flist flist(vals.cbegin(), vals.cend());
@@ -2,40 +2,69 @@
 #define SORTING_ALGORITHMS_HPP
 #include <iterator>
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <vector>
 #include <forward_list.hpp>
 
 namespace zaitsev
 {
-  template< class ForwardIt, class Comapare >
-  void shellSort(ForwardIt begin, ForwardIt end, Comapare cmp)
+  inline std::vector< size_t > getShellGaps(size_t size)
   {
-    size_t size = std::distance(begin, end);
-    size_t diff = size;
-    while (diff > 1)
+    const size_t ciura_gaps[] = { 1, 4, 10, 23, 57, 132, 301, 701, 1750 };
+    std::vector< size_t > gaps;
+    for (size_t gap: ciura_gaps)
     {
-      diff /= 2;
-      ForwardIt front_start = begin;
-      std::advance(front_start, diff);
-      size_t swaps = 1;
-      while (swaps != 0)
+      if (gap >= size && !gaps.empty())
       {
-        ForwardIt front = front_start;
-        ForwardIt back = begin;
-        swaps = 0;
-        while (front != end)
+        return gaps;
+      }
+      gaps.push_back(gap);
+    }
+    while (gaps.back() * 9 / 4 < size)
+    {
+      gaps.push_back(gaps.back() * 9 / 4);
+    }
+    return gaps;
+  }
+
+  template< class RandomIt, class Comapare >
+  void doShellSort(RandomIt begin, RandomIt end, Comapare cmp, std::random_access_iterator_tag)
+  {
+    using T = typename std::iterator_traits< RandomIt >::value_type;
+    size_t size = end - begin;
+    std::vector< size_t > gaps = getShellGaps(size);
+    for (std::vector< size_t >::const_reverse_iterator gap = gaps.crbegin(); gap != gaps.crend(); ++gap)
+    {
+      for (size_t i = *gap; i < size; ++i)
+      {
+        T temp = std::move(begin[i]);
+        size_t j = i;
+        for (; j >= *gap && cmp(temp, begin[j - *gap]); j -= *gap)
         {
-          if (cmp(*front, *back))
-          {
-            std::swap(*back, *front);
-            ++swaps;
-          }
-          ++front;
-          ++back;
+          begin[j] = std::move(begin[j - *gap]);
         }
+        begin[j] = std::move(temp);
       }
     }
   }
 
+  template< class ForwardIt, class Comapare >
+  void doShellSort(ForwardIt begin, ForwardIt end, Comapare cmp, std::forward_iterator_tag)
+  {
+    using T = typename std::iterator_traits< ForwardIt >::value_type;
+    std::vector< T > buffer(std::make_move_iterator(begin), std::make_move_iterator(end));
+    doShellSort(buffer.begin(), buffer.end(), cmp, std::random_access_iterator_tag{});
+    std::move(buffer.begin(), buffer.end(), begin);
+  }
+
+  template< class ForwardIt, class Comapare >
+  void shellSort(ForwardIt begin, ForwardIt end, Comapare cmp)
+  {
+    doShellSort(begin, end, cmp, typename std::iterator_traits< ForwardIt >::iterator_category{});
+  }
+
   template< class RandomIt, class Comapare >
   void bucketSort(RandomIt begin, RandomIt end, Comapare cmp, size_t buckets_nmb = 2)
   {
@@ -73,5 +102,103 @@ namespace zaitsev
       }
     }
   }
+
+  template< typename T >
+  struct RadixKey;
+
+  template<>
+  struct RadixKey< int >
+  {
+    static uint32_t encode(int value)
+    {
+      return static_cast< uint32_t >(value) ^ 0x80000000u;
+    }
+    static int decode(uint32_t key)
+    {
+      return static_cast< int >(key ^ 0x80000000u);
+    }
+  };
+
+  template<>
+  struct RadixKey< float >
+  {
+    static_assert(sizeof(float) == sizeof(uint32_t), "float is expected to be IEEE-754 binary32");
+    static uint32_t encode(float value)
+    {
+      uint32_t bits = 0;
+      std::memcpy(&bits, &value, sizeof(bits));
+      return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+    }
+    static float decode(uint32_t key)
+    {
+      uint32_t bits = (key & 0x80000000u) ? (key ^ 0x80000000u) : ~key;
+      float value = 0;
+      std::memcpy(&value, &bits, sizeof(value));
+      return value;
+    }
+  };
+
+  template< class Comapare >
+  struct RadixOrder;
+
+  template< typename T >
+  struct RadixOrder< std::less< T > >
+  {
+    static constexpr uint32_t mask = 0;
+  };
+
+  template< typename T >
+  struct RadixOrder< std::greater< T > >
+  {
+    static constexpr uint32_t mask = ~0u;
+  };
+
+  template< class ForwardIt, class Comapare >
+  void radixSort(ForwardIt begin, ForwardIt end, Comapare)
+  {
+    using T = typename std::iterator_traits< ForwardIt >::value_type;
+    constexpr size_t digit_bits = 11;
+    constexpr size_t digits_nmb = (32 + digit_bits - 1) / digit_bits;
+    constexpr size_t radix = size_t(1) << digit_bits;
+    const uint32_t mask = RadixOrder< Comapare >::mask;
+    std::vector< uint32_t > keys;
+    keys.reserve(std::distance(begin, end));
+    std::vector< size_t > counts(digits_nmb * radix, 0);
+    for (ForwardIt i = begin; i != end; ++i)
+    {
+      uint32_t key = RadixKey< T >::encode(*i) ^ mask;
+      keys.push_back(key);
+      for (size_t digit = 0; digit < digits_nmb; ++digit)
+      {
+        ++counts[digit * radix + ((key >> (digit * digit_bits)) & (radix - 1))];
+      }
+    }
+    std::vector< uint32_t > buffer(keys.size());
+    for (size_t digit = 0; digit < digits_nmb; ++digit)
+    {
+      size_t* count = counts.data() + digit * radix;
+      if (std::find(count, count + radix, keys.size()) != count + radix)
+      {
+        continue;
+      }
+      size_t sum = 0;
+      for (size_t i = 0; i < radix; ++i)
+      {
+        size_t bucket_size = count[i];
+        count[i] = sum;
+        sum += bucket_size;
+      }
+      for (uint32_t key: keys)
+      {
+        buffer[count[(key >> (digit * digit_bits)) & (radix - 1)]++] = key;
+      }
+      keys.swap(buffer);
+    }
+    std::vector< uint32_t >::const_iterator key = keys.cbegin();
+    for (ForwardIt i = begin; i != end; ++i, ++key)
+    {
+      *i = RadixKey< T >::decode(*key ^ mask);
+    }
+  }
 }
 #endif
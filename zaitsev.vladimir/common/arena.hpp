@@ -0,0 +1,131 @@
+#ifndef ARENA_HPP
+#define ARENA_HPP
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+namespace zaitsev
+{
+  class Arena
+  {
+    struct Block
+    {
+      Block* next_;
+    };
+    Block* head_;
+    char* cur_;
+    char* end_;
+    size_t next_size_;
+    size_t reserved_;
+
+    void addBlock(size_t min_size)
+    {
+      size_t size = next_size_;
+      while (size < min_size + sizeof(Block))
+      {
+        size *= 2;
+      }
+      Block* block = static_cast< Block* >(::operator new(size));
+      block->next_ = head_;
+      head_ = block;
+      cur_ = reinterpret_cast< char* >(block) + sizeof(Block);
+      end_ = reinterpret_cast< char* >(block) + size;
+      reserved_ += size;
+      next_size_ = (size < max_block_size) ? size * 2 : size;
+    }
+  public:
+    static constexpr size_t max_block_size = 1 << 20;
+
+    explicit Arena(size_t first_block = 4096) noexcept:
+      head_(nullptr),
+      cur_(nullptr),
+      end_(nullptr),
+      next_size_(first_block),
+      reserved_(0)
+    {}
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+    ~Arena()
+    {
+      while (head_)
+      {
+        Block* next = head_->next_;
+        ::operator delete(head_);
+        head_ = next;
+      }
+    }
+    void* allocate(size_t size, size_t align)
+    {
+      size_t pad = (align - reinterpret_cast< std::uintptr_t >(cur_) % align) % align;
+      if (!cur_ || static_cast< size_t >(end_ - cur_) < pad + size)
+      {
+        addBlock(size + align);
+        pad = (align - reinterpret_cast< std::uintptr_t >(cur_) % align) % align;
+      }
+      void* res = cur_ + pad;
+      cur_ += pad + size;
+      return res;
+    }
+    size_t reserved() const noexcept
+    {
+      return reserved_;
+    }
+  };
+
+  // Without an arena the allocator falls back to the global heap, so
+  // temporaries and sentinels do not reserve a block of their own.
+  template< typename T >
+  class ArenaAllocator
+  {
+    template< typename U > friend class ArenaAllocator;
+    std::shared_ptr< Arena > arena_;
+  public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    ArenaAllocator() noexcept:
+      arena_()
+    {}
+    explicit ArenaAllocator(std::shared_ptr< Arena > arena) noexcept:
+      arena_(std::move(arena))
+    {}
+    template< typename U >
+    ArenaAllocator(const ArenaAllocator< U >& other) noexcept:
+      arena_(other.arena_)
+    {}
+    T* allocate(size_t n)
+    {
+      if (!arena_)
+      {
+        return static_cast< T* >(::operator new(n * sizeof(T)));
+      }
+      return static_cast< T* >(arena_->allocate(n * sizeof(T), alignof(T)));
+    }
+    void deallocate(T* ptr, size_t) noexcept
+    {
+      if (!arena_)
+      {
+        ::operator delete(ptr);
+      }
+    }
+    const std::shared_ptr< Arena >& arena() const noexcept
+    {
+      return arena_;
+    }
+    template< typename U >
+    bool operator==(const ArenaAllocator< U >& other) const noexcept
+    {
+      return arena_ == other.arena_;
+    }
+    template< typename U >
+    bool operator!=(const ArenaAllocator< U >& other) const noexcept
+    {
+      return arena_ != other.arena_;
+    }
+  };
+}
+#endif
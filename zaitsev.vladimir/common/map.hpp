@@ -4,17 +4,23 @@
 #include <initializer_list>
 #include <memory>
 #include <stdexcept>
+#include <tuple>
+#include <type_traits>
 #include <stack.hpp>
 #include <queue.hpp>
 
 namespace zaitsev
 {
-  template< typename Key, typename T, typename Compare = std::less< Key > >
+  template< typename Key, typename T, typename Compare = std::less< Key >,
+    typename Allocator = std::allocator< std::pair< const Key, T > > >
   class Map
   {
     using val_t = std::pair< const Key, T >;
     struct Node;
+    using node_alloc_t = typename std::allocator_traits< Allocator >::template rebind_alloc< Node >;
+    using node_traits = std::allocator_traits< node_alloc_t >;
     Compare comparator_;
+    node_alloc_t alloc_;
     Node* fakeroot_;
     size_t size_;
     struct Node
@@ -171,6 +177,43 @@ namespace zaitsev
         return new_root;
       }
     };
+    template< class... Args >
+    Node* allocNode(Args&&... args)
+    {
+      Node* node = node_traits::allocate(alloc_, 1);
+      try
+      {
+        node_traits::construct(alloc_, node, std::forward< Args >(args)...);
+      }
+      catch (...)
+      {
+        node_traits::deallocate(alloc_, node, 1);
+        throw;
+      }
+      return node;
+    }
+    void freeNode(Node* node) noexcept
+    {
+      node_traits::destroy(alloc_, node);
+      node_traits::deallocate(alloc_, node, 1);
+    }
+    template< class... Args >
+    Node* createNode(const Key& key, Args&&... args)
+    {
+      return constructNode(std::uses_allocator< T, Allocator >(), key, std::forward< Args >(args)...);
+    }
+    template< class... Args >
+    Node* constructNode(std::true_type, const Key& key, Args&&... args)
+    {
+      return allocNode(0, std::piecewise_construct, std::forward_as_tuple(key),
+        std::forward_as_tuple(std::forward< Args >(args)..., alloc_));
+    }
+    template< class... Args >
+    Node* constructNode(std::false_type, const Key& key, Args&&... args)
+    {
+      return allocNode(0, std::piecewise_construct, std::forward_as_tuple(key),
+        std::forward_as_tuple(std::forward< Args >(args)...));
+    }
     Node* findHint(Node* root, const Key& key)
     {
       Node* cur = (root->height_ < 0) ? root->left_ : root;
@@ -245,39 +288,42 @@ namespace zaitsev
         cur = cur->parent_;
         if (cur->left_ && !cur->left_->left_ && !cur->left_->right_)
         {
-          delete cur->left_;
+          freeNode(cur->left_);
           cur->left_ = nullptr;
         }
         if (cur->right_ && !cur->right_->left_ && !cur->right_->right_)
         {
-          delete cur->right_;
+          freeNode(cur->right_);
           cur->right_ = nullptr;
         }
       }
-      delete root;
+      freeNode(root);
     }
-    Node* addNode(Node* root, Node* hint, const Key& key, const T& new_val)
+    Node* linkNode(Node* root, Node* hint, Node* new_node)
     {
       if (!hint)
       {
-        hint = findHint(root, key);
+        root->left_ = new_node;
+        new_node->parent_ = root;
+        return new_node;
       }
+      (comparator_(hint->val_.first, new_node->val_.first) ? hint->right_ : hint->left_) = new_node;
+      new_node->parent_ = hint;
+      rebalanceTree(hint);
+      return new_node;
+    }
+    Node* addNode(Node* root, Node* hint, const Key& key, const T& new_val)
+    {
       if (!hint)
       {
-        root->left_ = new Node(0, std::forward< val_t >(std::make_pair(key, new_val)));
-        root->left_->parent_ = root;
-        return root->left_;
+        hint = findHint(root, key);
       }
-      if (hint->val_.first == key)
+      if (hint && hint->val_.first == key)
       {
         hint->val_.second = new_val;
         return hint;
       }
-      Node* new_node = new Node(0, std::forward< val_t >(std::make_pair(key, new_val)));
-      (comparator_(hint->val_.first, key) ? hint->right_ : hint->left_) = new_node;
-      new_node->parent_ = hint;
-      rebalanceTree(hint);
-      return new_node;
+      return linkNode(root, hint, createNode(key, new_val));
     }
     void eraseNode(Node* for_del)
     {
@@ -304,15 +350,20 @@ namespace zaitsev
         }
         ((for_del == parent->left_) ? parent->left_ : parent->right_) = prev;
         prev->parent_ = parent;
+        prev->height_ = for_del->height_;
         if (prev_parent != for_del)
         {
           prev_parent->right_ = prev->left_;
-          prev->left_->parent_ = prev_parent;
+          if (prev->left_)
+          {
+            prev->left_->parent_ = prev_parent;
+          }
           prev->left_ = for_del->left_;
+          prev->left_->parent_ = prev;
         }
         rebalanceTree((prev_parent != for_del) ? prev_parent : prev);
       }
-      delete for_del;
+      freeNode(for_del);
     }
     template< typename InputIt >
     Node* createMap(Node* fakeroot, InputIt begin, InputIt end, size_t& nmb_of_added)
@@ -325,9 +376,9 @@ namespace zaitsev
       bool fake_given = fakeroot;
       if (!fakeroot)
       {
-        fakeroot_ = new Node(-1);
+        fakeroot_ = allocNode(-1);
       }
-      fakeroot->left_ = new Node(0, std::forward(*begin));
+      fakeroot->left_ = createNode((*begin).first, (*begin).second);
       fakeroot->left_->parent_ = fakeroot;
       ++begin;
       ++nmb_of_added;
@@ -352,7 +403,7 @@ namespace zaitsev
     class BaseIterator
     {
       template< bool U > friend class BaseIterator;
-      template< typename T1, typename T2, class T3 > friend class Map;
+      template< typename T1, typename T2, class T3, class T4 > friend class Map;
       using val_t = std::conditional_t< IsConst, const std::pair< const Key, T >, std::pair< const Key, T > >;
       using prt_t = std::conditional_t< IsConst, const val_t*, val_t* >;
       using ref_t = std::conditional_t< IsConst, const val_t&, val_t& >;
@@ -445,7 +496,7 @@ namespace zaitsev
     class BaseLNRIterator
     {
       template< bool U > friend class BaseLNRIterator;
-      template< typename T1, typename T2, class T3 > friend class Map;
+      template< typename T1, typename T2, class T3, class T4 > friend class Map;
       using val_t = std::conditional_t< IsConst, const std::pair< const Key, T >, std::pair< const Key, T > >;
       using prt_t = std::conditional_t< IsConst, const val_t*, val_t* >;
       using ref_t = std::conditional_t< IsConst, const val_t&, val_t& >;
@@ -546,6 +597,7 @@ namespace zaitsev
       }
     };
   public:
+    using allocator_type = Allocator;
     using iterator = BaseIterator< false >;
     using const_iterator = BaseIterator< true >;
     using reverse_iterator = std::reverse_iterator< iterator >;
@@ -557,12 +609,23 @@ namespace zaitsev
     using const_rnl_iterator = std::reverse_iterator< const_lnr_iterator >;
     Map():
       comparator_(),
-      fakeroot_(new Node(-1)),
+      alloc_(),
+      fakeroot_(allocNode(-1)),
+      size_(0)
+    {}
+    explicit Map(const Allocator& alloc):
+      comparator_(),
+      alloc_(alloc),
+      fakeroot_(allocNode(-1)),
       size_(0)
     {}
     Map(const Map& other):
+      Map(other, node_traits::select_on_container_copy_construction(other.alloc_))
+    {}
+    Map(const Map& other, const Allocator& alloc):
       comparator_(other.comparator_),
-      fakeroot_(new Node(-1)),
+      alloc_(alloc),
+      fakeroot_(allocNode(-1)),
       size_(other.size_)
     {
       size_t added = 0;
@@ -574,7 +637,8 @@ namespace zaitsev
         {
           if (cur_other->right_ && !cur->right_)
           {
-            cur->right_ = new Node(*(cur_other->right_));
+            cur->right_ = createNode(cur_other->right_->val_.first, cur_other->right_->val_.second);
+            cur->right_->height_ = cur_other->right_->height_;
             cur->right_->parent_ = cur;
             cur = cur->right_;
             cur_other = cur_other->right_;
@@ -583,7 +647,8 @@ namespace zaitsev
           }
           if (cur_other->left_ && !cur->left_)
           {
-            cur->left_ = new Node(*(cur_other->left_));
+            cur->left_ = createNode(cur_other->left_->val_.first, cur_other->left_->val_.second);
+            cur->left_->height_ = cur_other->left_->height_;
             cur->left_->parent_ = cur;
             cur = cur->left_;
             cur_other = cur_other->left_;
@@ -602,6 +667,7 @@ namespace zaitsev
     }
     Map(Map&& other) noexcept:
       comparator_(std::move(other.comparator_)),
+      alloc_(other.alloc_),
       fakeroot_(other.fakeroot_),
       size_(other.size_)
     {
@@ -610,7 +676,8 @@ namespace zaitsev
     }
     Map(std::initializer_list< std::pair< const Key, T > > init_list):
       comparator_(),
-      fakeroot_(new Node(-1)),
+      alloc_(),
+      fakeroot_(allocNode(-1)),
       size_(0)
     {
       try
@@ -625,7 +692,8 @@ namespace zaitsev
     template< typename InputIt >
     Map(InputIt begin, InputIt end):
       comparator_(),
-      fakeroot_(new Node(-1)),
+      alloc_(),
+      fakeroot_(allocNode(-1)),
       size_(0)
     {
       try
@@ -867,6 +935,10 @@ namespace zaitsev
       return f;
     }
 
+    allocator_type get_allocator() const
+    {
+      return allocator_type(alloc_);
+    }
     bool empty() const noexcept
     {
       return !size_;
@@ -884,6 +956,7 @@ namespace zaitsev
     void swap(Map& other)
     {
       std::swap(comparator_, other.comparator_);
+      std::swap(alloc_, other.alloc_);
       std::swap(fakeroot_, other.fakeroot_);
       std::swap(size_, other.size_);
     }
@@ -1004,7 +1077,7 @@ namespace zaitsev
       {
         return cur->val_.second;
       }
-      Node* added = addNode(fakeroot_, cur, key, T{});
+      Node* added = linkNode(fakeroot_, cur, createNode(key));
       ++size_;
       return added->val_.second;
     }
@@ -4,13 +4,13 @@
 #include <iosfwd>
 
 #include <calc/expressionTokens.hpp>
-#include <tree/twoThreeTree.hpp>
+#include <tree/bTree.hpp>
 #include <list/list.hpp>
 
 namespace zhalilov
 {
-  using varModule = TwoThree< std::string, List< InfixToken > >;
-  using modulesMap = TwoThree< std::string, varModule >;
+  using varModule = BTree< std::string, List< InfixToken > >;
+  using modulesMap = BTree< std::string, varModule >;
   void calc(const modulesMap &, const std::string &, std::istream &, std::ostream &);
   void modulesadd(modulesMap &, std::istream &, std::ostream &);
   void modulesvaradd(modulesMap &, std::istream &, std::ostream &);
@@ -16,8 +16,8 @@ void clearStream(std::istream &in)
 int main()
 {
   using namespace zhalilov;
-  using varModule = TwoThree< std::string, List< InfixToken > >;
-  using modulesMap = TwoThree< std::string, varModule >;
+  using varModule = BTree< std::string, List< InfixToken > >;
+  using modulesMap = BTree< std::string, varModule >;
   modulesMap modules;
 
   TwoThree< std::string, std::function< void(std::istream &, std::ostream &) > > commands;
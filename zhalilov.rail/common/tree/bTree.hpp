@@ -0,0 +1,820 @@
+#ifndef BTREE_HPP
+#define BTREE_HPP
+
+#include <functional>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+#include <queue.hpp>
+
+#include "bTreeIterator.hpp"
+#include "const_bTreeIterator.hpp"
+#include "bTreeNode.hpp"
+
+namespace zhalilov
+{
+  // Same interface as TwoThree, but every node keeps up to 2 * Degree - 1 pairs
+  // in one contiguous block, so a lookup touches about log_Degree(n) nodes
+  // instead of log_2(n). Values move between nodes on insert and erase, so, as
+  // with a flat container, any insert or erase invalidates all iterators.
+  template < class Key, class T, class Compare = std::less< Key >, size_t Degree = 16 >
+  class BTree
+  {
+    static_assert(Degree >= 2, "BTree: degree must be at least 2");
+
+  public:
+    using MapPair = std::pair< Key, T >;
+    using iterator = BTreeIterator< MapPair, Degree >;
+    using const_iterator = ConstBTreeIterator< MapPair, Degree >;
+
+    BTree();
+    BTree(const BTree &);
+    BTree(BTree &&) noexcept;
+    ~BTree();
+
+    BTree &operator=(const BTree &);
+    BTree &operator=(BTree &&) noexcept;
+
+    T &at(const Key &);
+    const T &at(const Key &) const;
+    T &operator[](const Key &);
+    T &operator[](Key &&);
+
+    iterator begin();
+    const_iterator begin() const;
+    const_iterator cbegin() const noexcept;
+    iterator end();
+    const_iterator end() const;
+    const_iterator cend() const noexcept;
+
+    bool empty() const noexcept;
+    size_t size() const noexcept;
+
+    std::pair< iterator, bool > insert(const MapPair &);
+    iterator erase(iterator);
+    iterator erase(const_iterator);
+    size_t erase(const Key &);
+    void clear() noexcept;
+    void swap(BTree &) noexcept;
+
+    iterator find(const Key &);
+    const_iterator find(const Key &) const;
+
+    template < class F >
+    F traverse_lnr(F f) const;
+    template < class F >
+    F traverse_lnr(F f);
+    template < class F >
+    F traverse_rnl(F f) const;
+    template < class F >
+    F traverse_rnl(F f);
+    template < class F >
+    F traverse_breadth(F f) const;
+    template < class F >
+    F traverse_breadth(F f);
+
+    size_t count(const Key &) const;
+    std::pair< iterator, iterator > equal_range(const Key &);
+    std::pair< const_iterator, const_iterator > equal_range(const Key &) const;
+
+  private:
+    using Node = detail::BTreeNode< MapPair, Degree >;
+    using Leaf = detail::BTreeLeaf< MapPair, Degree >;
+    using Internal = detail::BTreeInternal< MapPair, Degree >;
+    static constexpr size_t maxSize = 2 * Degree - 1;
+    static constexpr size_t minSize = Degree - 1;
+
+    Compare compare_;
+    mutable detail::BTreeHeader< MapPair, Degree > head_;
+    size_t size_;
+
+    std::pair< iterator, bool > doFind(const Key &) const;
+    iterator lowerBound(const Key &) const;
+    Node *createNode(bool isLeaf) const;
+    static void freeNode(Node *) noexcept;
+    static void deleteNode(Node *) noexcept;
+    Node *copyNode(Node *from, Node *parent) const;
+    static void moveValue(Node *from, size_t fromIndex, Node *to, size_t toIndex);
+
+    void splitNode(Node *);
+    void balanceAfterErase(Node *);
+    void rotateLeft(Node *parent, size_t index);
+    void rotateRight(Node *parent, size_t index);
+    void mergeChildren(Node *parent, size_t index);
+  };
+
+  template < class Key, class T, class Compare, size_t Degree >
+  BTree< Key, T, Compare, Degree >::BTree():
+    compare_(Compare{}),
+    head_(),
+    size_(0)
+  {}
+
+  template < class Key, class T, class Compare, size_t Degree >
+  BTree< Key, T, Compare, Degree >::BTree(const BTree &other):
+    compare_(other.compare_),
+    head_(),
+    size_(0)
+  {
+    if (other.head_.root)
+    {
+      head_.root = copyNode(other.head_.root, &head_);
+    }
+    size_ = other.size_;
+  }
+
+  template < class Key, class T, class Compare, size_t Degree >
+  BTree< Key, T, Compare, Degree >::BTree(BTree &&other) noexcept:
+    compare_(std::move(other.compare_)),
+    head_(),
+    size_(other.size_)
+  {
+    head_.root = other.head_.root;
+    if (head_.root)
+    {
+      head_.root->parent = &head_;
+    }
+    other.head_.root = nullptr;
+    other.size_ = 0;
+  }
+
+  template < class Key, class T, class Compare, size_t Degree >
+  BTree< Key, T, Compare, Degree >::~BTree()
+  {
+    clear();
+  }
+
+  template < class Key, class T, class Compare, size_t Degree >
+  BTree< Key, T, Compare, Degree > &BTree< Key, T, Compare, Degree >::operator=(const BTree &other)
+  {
+    if (this != &other)
+    {
+      BTree temp(other);
+      swap(temp);
+    }
+    return *this;
+  }
+
+  template < class Key, class T, class Compare, size_t Degree >
+  BTree< Key, T, Compare, Degree > &BTree< Key, T, Compare, Degree >::operator=(BTree &&other) noexcept
+  {
+    if (this != &other)
+    {
+      clear();
+      swap(other);
+    }
+    return *this;
+  }
+
+  template < class Key, class T, class Compare, size_t Degree >
+  T &BTree< Key, T, Compare, Degree >::at(const Key &key)
+  {
+    auto it = find(key);
+    if (it == end())
+    {
+      throw std::out_of_range("BTree: accessing element doesn't exist");
+    }
+    return it->second;
+  }
+
+  template < class Key, class T, class Compare, size_t Degree >
+  const T &BTree< Key, T, Compare, Degree >::at(const Key &key) const
+  {
+    auto it = find(key);
+    if (it == cend())
+    {
+      throw std::out_of_range("BTree: accessing element doesn't exist");
+    }
+    return it->second;
+  }
+
+  template < class Key, class T, class Compare, size_t Degree >
+  T &BTree< Key, T, Compare, Degree >::operator[](const Key &key)
+  {
+    auto resultPair = doFind(key);
+    if (resultPair.second)
+    {
+      return resultPair.first->second;
+    }
+    return insert(std::make_pair(key, T())).first->second;
+  }
+
+  template < class Key, class T, class Compare, size_t Degree >
+  T &BTree< Key, T, Compare, Degree >::operator[](Key &&key)
+  {
+    auto resultPair = doFind(key);
+    if (resultPair.second)
+    {
+      return resultPair.first->second;
+    }
+    return insert(std::make_pair(std::move(key), T())).first->second;
+  }
+
+  template < class Key, class T, class Compare, size_t Degree >
+  typename BTree< Key, T, Compare, Degree >::iterator BTree< Key, T, Compare, Degree >::begin()
+  {
+    return iterator::findDeepestLeft(&head_);
+  }
+
+  template < class Key, class T, class Compare, size_t Degree >
+  typename BTree< Key, T, Compare, Degree >::const_iterator BTree< Key, T, Compare, Degree >::begin() const
+  {
+    return const_iterator(iterator::findDeepestLeft(&head_));
+  }
+
+  template < class Key, class T, class Compare, size_t Degree >
+  typename BTree< Key, T, Compare, Degree >::const_iterator BTree< Key, T, Compare, Degree >::cbegin() const noexcept
+  {
+    return const_iterator(iterator::findDeepestLeft(&head_));
+  }
+
+  template < class Key, class T, class Compare, size_t Degree >
+  typename BTree< Key, T, Compare, Degree >::iterator BTree< Key, T, Compare, Degree >::end()
+  {
+    return iterator(&head_, 0);
+  }
+
+  template < class Key, class T, class Compare, size_t Degree >
+  typename BTree< Key, T, Compare, Degree >::const_iterator BTree< Key, T, Compare, Degree >::end() const
+  {
+    return const_iterator(iterator(&head_, 0));
+  }
+
+  template < class Key, class T, class Compare, size_t Degree >
+  typename BTree< Key, T, Compare, Degree >::const_iterator BTree< Key, T, Compare, Degree >::cend() const noexcept
+  {
+    return const_iterator(iterator(&head_, 0));
+  }
+
+  template < class Key, class T, class Compare, size_t Degree >
+  bool BTree< Key, T, Compare, Degree >::empty() const noexcept
+  {
+    return size_ == 0;
+  }
+
+  template < class Key, class T, class Compare, size_t Degree >
+  size_t BTree< Key, T, Compare, Degree >::size() const noexcept
+  {
+    return size_;
+  }
+
+  template < class Key, class T, class Compare, size_t Degree >
+  std::pair< typename BTree< Key, T, Compare, Degree >::iterator, bool >
+  BTree< Key, T, Compare, Degree >::insert(const MapPair &newPair)
+  {
+    auto resultPair = doFind(newPair.first);
+    if (resultPair.second)
+    {
+      return std::make_pair(resultPair.first, false);
+    }
+    MapPair temp(newPair);
+    Node *currNode = resultPair.first.node_;
+    size_t index = resultPair.first.index_;
+    if (currNode == &head_)
+    {
+      head_.root = createNode(true);
+      head_.root->parent = &head_;
+      currNode = head_.root;
+    }
+    else if (currNode->size == maxSize)
+    {
+      splitNode(currNode);
+      if (index > minSize)
+      {
+        currNode = detail::getChild(currNode->parent, detail::getIndexInParent(currNode) + 1);
+        index -= Degree;
+      }
+    }
+    for (size_t i = currNode->size; i > index; i--)
+    {
+      moveValue(currNode, i - 1, currNode, i);
+    }
+    new (detail::getSlot(currNode, index)) MapPair(std::move(temp));
+    currNode->size++;
+    size_++;
+    return std::make_pair(iterator(currNode, index), true);
+  }
+
+  template < class Key, class T, class Compare, size_t Degree >
+  typename BTree< Key, T, Compare, Degree >::iterator BTree< Key, T, Compare, Degree >::erase(iterator it)
+  {
+    Key erasedKey = it->first;
+    Node *currNode = it.node_;
+    size_t index = it.index_;
+    if (!currNode->isLeaf)
+    {
+      iterator prevIt = iterator::findDeepestRight(detail::getChild(currNode, index));
+      *it = std::move(*prevIt);
+      currNode = prevIt.node_;
+      index = prevIt.index_;
+    }
+    detail::getValue(currNode, index).~MapPair();
+    for (size_t i = index + 1; i < currNode->size; i++)
+    {
+      moveValue(currNode, i, currNode, i - 1);
+    }
+    currNode->size--;
+    size_--;
+    balanceAfterErase(currNode);
+    return lowerBound(erasedKey);
+  }
+
+  template < class Key, class T, class Compare, size_t Degree >
+  typename BTree< Key, T, Compare, Degree >::iterator BTree< Key, T, Compare, Degree >::erase(const_iterator it)
+  {
+    return erase(it.it_);
+  }
+
+  template < class Key, class T, class Compare, size_t Degree >
+  size_t BTree< Key, T, Compare, Degree >::erase(const Key &key)
+  {
+    auto result = find(key);
+    if (result != end())
+    {
+      erase(result);
+      return 1;
+    }
+    return 0;
+  }
+
+  template < class Key, class T, class Compare, size_t Degree >
+  void BTree< Key, T, Compare, Degree >::clear() noexcept
+  {
+    if (head_.root)
+    {
+      deleteNode(head_.root);
+      head_.root = nullptr;
+    }
+    size_ = 0;
+  }
+
+  template < class Key, class T, class Compare, size_t Degree >
+  void BTree< Key, T, Compare, Degree >::swap(BTree &other) noexcept
+  {
+    std::swap(compare_, other.compare_);
+    std::swap(head_.root, other.head_.root);
+    std::swap(size_, other.size_);
+    if (head_.root)
+    {
+      head_.root->parent = &head_;
+    }
+    if (other.head_.root)
+    {
+      other.head_.root->parent = &other.head_;
+    }
+  }
+
+  template < class Key, class T, class Compare, size_t Degree >
+  typename BTree< Key, T, Compare, Degree >::iterator BTree< Key, T, Compare, Degree >::find(const Key &key)
+  {
+    auto resultPair = doFind(key);
+    if (resultPair.second)
+    {
+      return resultPair.first;
+    }
+    return end();
+  }
+
+  template < class Key, class T, class Compare, size_t Degree >
+  typename BTree< Key, T, Compare, Degree >::const_iterator BTree< Key, T, Compare, Degree >::find(const Key &key) const
+  {
+    auto resultPair = doFind(key);
+    if (resultPair.second)
+    {
+      return const_iterator(resultPair.first);
+    }
+    return cend();
+  }
+
+  template < class Key, class T, class Compare, size_t Degree >
+  template < class F >
+  F BTree< Key, T, Compare, Degree >::traverse_lnr(F f) const
+  {
+    if (empty())
+    {
+      throw std::logic_error("travers_lnr: empty tree");
+    }
+    auto itCurr = cbegin();
+    auto itEnd = cend();
+    while (itCurr != itEnd)
+    {
+      f(*itCurr);
+      itCurr++;
+    }
+    return f;
+  }
+
+  template < class Key, class T, class Compare, size_t Degree >
+  template < class F >
+  F BTree< Key, T, Compare, Degree >::traverse_lnr(F f)
+  {
+    return static_cast< const BTree & >(*this).traverse_lnr(f);
+  }
+
+  template < class Key, class T, class Compare, size_t Degree >
+  template < class F >
+  F BTree< Key, T, Compare, Degree >::traverse_rnl(F f) const
+  {
+    if (empty())
+    {
+      throw std::logic_error("travers_rnl: empty tree");
+    }
+    auto itCurr = cend();
+    auto itBegin = cbegin();
+    do
+    {
+      itCurr--;
+      f(*itCurr);
+    }
+    while (itCurr != itBegin);
+    return f;
+  }
+
+  template < class Key, class T, class Compare, size_t Degree >
+  template < class F >
+  F BTree< Key, T, Compare, Degree >::traverse_rnl(F f)
+  {
+    return static_cast< const BTree & >(*this).traverse_rnl(f);
+  }
+
+  template < class Key, class T, class Compare, size_t Degree >
+  template < class F >
+  F BTree< Key, T, Compare, Degree >::traverse_breadth(F f) const
+  {
+    if (empty())
+    {
+      throw std::logic_error("travers_breadth: tree empty");
+    }
+    Queue< Node * > nodeQueue;
+    nodeQueue.push(head_.root);
+    while (!nodeQueue.empty())
+    {
+      Node *currNode = nodeQueue.front();
+      nodeQueue.pop();
+      for (size_t i = 0; i < currNode->size; i++)
+      {
+        f(static_cast< const MapPair & >(detail::getValue(currNode, i)));
+      }
+      if (!currNode->isLeaf)
+      {
+        for (size_t i = 0; i <= currNode->size; i++)
+        {
+          nodeQueue.push(detail::getChild(currNode, i));
+        }
+      }
+    }
+    return f;
+  }
+
+  template < class Key, class T, class Compare, size_t Degree >
+  template < class F >
+  F BTree< Key, T, Compare, Degree >::traverse_breadth(F f)
+  {
+    return static_cast< const BTree & >(*this).traverse_breadth(f);
+  }
+
+  template < class Key, class T, class Compare, size_t Degree >
+  size_t BTree< Key, T, Compare, Degree >::count(const Key &key) const
+  {
+    return doFind(key).second ? 1 : 0;
+  }
+
+  template < class Key, class T, class Compare, size_t Degree >
+  std::pair< typename BTree< Key, T, Compare, Degree >::iterator, typename BTree< Key, T, Compare, Degree >::iterator >
+  BTree< Key, T, Compare, Degree >::equal_range(const Key &key)
+  {
+    auto firstIt = lowerBound(key);
+    auto secondIt = firstIt;
+    if (secondIt != end() && !compare_(key, secondIt->first))
+    {
+      secondIt++;
+    }
+    return std::make_pair(firstIt, secondIt);
+  }
+
+  template < class Key, class T, class Compare, size_t Degree >
+  std::pair< typename BTree< Key, T, Compare, Degree >::const_iterator, typename BTree< Key, T, Compare, Degree >::const_iterator >
+  BTree< Key, T, Compare, Degree >::equal_range(const Key &key) const
+  {
+    auto resultPair = const_cast< BTree & >(*this).equal_range(key);
+    return std::make_pair(const_iterator(resultPair.first), const_iterator(resultPair.second));
+  }
+
+  template < class Key, class T, class Compare, size_t Degree >
+  std::pair< typename BTree< Key, T, Compare, Degree >::iterator, bool >
+  BTree< Key, T, Compare, Degree >::doFind(const Key &key) const
+  {
+    Node *currNode = head_.root;
+    if (!currNode)
+    {
+      return std::make_pair(iterator(&head_, 0), false);
+    }
+    while (true)
+    {
+      size_t lower = 0;
+      size_t upper = currNode->size;
+      while (lower < upper)
+      {
+        size_t mid = lower + (upper - lower) / 2;
+        if (compare_(detail::getValue(currNode, mid).first, key))
+        {
+          lower = mid + 1;
+        }
+        else
+        {
+          upper = mid;
+        }
+      }
+      if (lower < currNode->size && !compare_(key, detail::getValue(currNode, lower).first))
+      {
+        return std::make_pair(iterator(currNode, lower), true);
+      }
+      if (currNode->isLeaf)
+      {
+        return std::make_pair(iterator(currNode, lower), false);
+      }
+      currNode = detail::getChild(currNode, lower);
+    }
+  }
+
+  template < class Key, class T, class Compare, size_t Degree >
+  typename BTree< Key, T, Compare, Degree >::iterator BTree< Key, T, Compare, Degree >::lowerBound(const Key &key) const
+  {
+    auto resultPair = doFind(key);
+    iterator it = resultPair.first;
+    if (!resultPair.second && it.node_ != &head_ && it.index_ == it.node_->size)
+    {
+      it.index_--;
+      it++;
+    }
+    return it;
+  }
+
+  template < class Key, class T, class Compare, size_t Degree >
+  typename BTree< Key, T, Compare, Degree >::Node *BTree< Key, T, Compare, Degree >::createNode(bool isLeaf) const
+  {
+    Node *newNode = nullptr;
+    if (isLeaf)
+    {
+      newNode = new Leaf;
+    }
+    else
+    {
+      newNode = new Internal;
+    }
+    newNode->parent = nullptr;
+    newNode->size = 0;
+    newNode->isLeaf = isLeaf;
+    return newNode;
+  }
+
+  template < class Key, class T, class Compare, size_t Degree >
+  void BTree< Key, T, Compare, Degree >::freeNode(Node *node) noexcept
+  {
+    if (node->isLeaf)
+    {
+      delete static_cast< Leaf * >(node);
+    }
+    else
+    {
+      delete static_cast< Internal * >(node);
+    }
+  }
+
+  template < class Key, class T, class Compare, size_t Degree >
+  void BTree< Key, T, Compare, Degree >::deleteNode(Node *node) noexcept
+  {
+    for (size_t i = 0; i < node->size; i++)
+    {
+      detail::getValue(node, i).~MapPair();
+    }
+    if (!node->isLeaf)
+    {
+      for (size_t i = 0; i <= node->size; i++)
+      {
+        Node *child = detail::getChild(node, i);
+        if (child)
+        {
+          deleteNode(child);
+        }
+      }
+    }
+    freeNode(node);
+  }
+
+  template < class Key, class T, class Compare, size_t Degree >
+  typename BTree< Key, T, Compare, Degree >::Node *BTree< Key, T, Compare, Degree >::copyNode(Node *from, Node *parent) const
+  {
+    Node *newNode = createNode(from->isLeaf);
+    newNode->parent = parent;
+    if (!from->isLeaf)
+    {
+      for (size_t i = 0; i <= from->size; i++)
+      {
+        detail::getChild(newNode, i) = nullptr;
+      }
+    }
+    try
+    {
+      for (; newNode->size < from->size; newNode->size++)
+      {
+        new (detail::getSlot(newNode, newNode->size)) MapPair(detail::getValue(from, newNode->size));
+      }
+      if (!from->isLeaf)
+      {
+        for (size_t i = 0; i <= from->size; i++)
+        {
+          detail::getChild(newNode, i) = copyNode(detail::getChild(from, i), newNode);
+        }
+      }
+    }
+    catch (...)
+    {
+      deleteNode(newNode);
+      throw;
+    }
+    return newNode;
+  }
+
+  template < class Key, class T, class Compare, size_t Degree >
+  void BTree< Key, T, Compare, Degree >::moveValue(Node *from, size_t fromIndex, Node *to, size_t toIndex)
+  {
+    MapPair &value = detail::getValue(from, fromIndex);
+    new (detail::getSlot(to, toIndex)) MapPair(std::move(value));
+    value.~MapPair();
+  }
+
+  template < class Key, class T, class Compare, size_t Degree >
+  void BTree< Key, T, Compare, Degree >::splitNode(Node *node)
+  {
+    Node *parent = node->parent;
+    if (parent != &head_ && parent->size == maxSize)
+    {
+      splitNode(parent);
+      parent = node->parent;
+    }
+    Node *right = createNode(node->isLeaf);
+    if (parent == &head_)
+    {
+      try
+      {
+        parent = createNode(false);
+      }
+      catch (...)
+      {
+        freeNode(right);
+        throw;
+      }
+      parent->parent = &head_;
+      detail::getChild(parent, 0) = node;
+      node->parent = parent;
+      head_.root = parent;
+    }
+    right->parent = parent;
+    size_t pos = detail::getIndexInParent(node);
+    for (size_t i = parent->size; i > pos; i--)
+    {
+      moveValue(parent, i - 1, parent, i);
+      detail::getChild(parent, i + 1) = detail::getChild(parent, i);
+    }
+    moveValue(node, minSize, parent, pos);
+    detail::getChild(parent, pos + 1) = right;
+    parent->size++;
+    for (size_t i = Degree; i < maxSize; i++)
+    {
+      moveValue(node, i, right, i - Degree);
+    }
+    if (!node->isLeaf)
+    {
+      for (size_t i = Degree; i <= maxSize; i++)
+      {
+        Node *child = detail::getChild(node, i);
+        detail::getChild(right, i - Degree) = child;
+        child->parent = right;
+      }
+    }
+    node->size = minSize;
+    right->size = minSize;
+  }
+
+  template < class Key, class T, class Compare, size_t Degree >
+  void BTree< Key, T, Compare, Degree >::balanceAfterErase(Node *node)
+  {
+    while (node != head_.root && node->size < minSize)
+    {
+      Node *parent = node->parent;
+      size_t pos = detail::getIndexInParent(node);
+      if (pos > 0 && detail::getChild(parent, pos - 1)->size > minSize)
+      {
+        rotateRight(parent, pos - 1);
+        return;
+      }
+      if (pos < parent->size && detail::getChild(parent, pos + 1)->size > minSize)
+      {
+        rotateLeft(parent, pos);
+        return;
+      }
+      mergeChildren(parent, (pos > 0) ? pos - 1 : pos);
+      node = parent;
+    }
+    Node *root = head_.root;
+    if (root->size == 0)
+    {
+      if (root->isLeaf)
+      {
+        head_.root = nullptr;
+      }
+      else
+      {
+        head_.root = detail::getChild(root, 0);
+        head_.root->parent = &head_;
+      }
+      freeNode(root);
+    }
+  }
+
+  template < class Key, class T, class Compare, size_t Degree >
+  void BTree< Key, T, Compare, Degree >::rotateLeft(Node *parent, size_t index)
+  {
+    Node *left = detail::getChild(parent, index);
+    Node *right = detail::getChild(parent, index + 1);
+    moveValue(parent, index, left, left->size);
+    moveValue(right, 0, parent, index);
+    if (!left->isLeaf)
+    {
+      Node *child = detail::getChild(right, 0);
+      detail::getChild(left, left->size + 1) = child;
+      child->parent = left;
+      detail::getChild(right, 0) = detail::getChild(right, 1);
+    }
+    for (size_t i = 1; i < right->size; i++)
+    {
+      moveValue(right, i, right, i - 1);
+      if (!right->isLeaf)
+      {
+        detail::getChild(right, i) = detail::getChild(right, i + 1);
+      }
+    }
+    left->size++;
+    right->size--;
+  }
+
+  template < class Key, class T, class Compare, size_t Degree >
+  void BTree< Key, T, Compare, Degree >::rotateRight(Node *parent, size_t index)
+  {
+    Node *left = detail::getChild(parent, index);
+    Node *right = detail::getChild(parent, index + 1);
+    for (size_t i = right->size; i > 0; i--)
+    {
+      moveValue(right, i - 1, right, i);
+      if (!right->isLeaf)
+      {
+        detail::getChild(right, i + 1) = detail::getChild(right, i);
+      }
+    }
+    if (!right->isLeaf)
+    {
+      Node *child = detail::getChild(left, left->size);
+      detail::getChild(right, 1) = detail::getChild(right, 0);
+      detail::getChild(right, 0) = child;
+      child->parent = right;
+    }
+    moveValue(parent, index, right, 0);
+    moveValue(left, left->size - 1, parent, index);
+    left->size--;
+    right->size++;
+  }
+
+  template < class Key, class T, class Compare, size_t Degree >
+  void BTree< Key, T, Compare, Degree >::mergeChildren(Node *parent, size_t index)
+  {
+    Node *left = detail::getChild(parent, index);
+    Node *right = detail::getChild(parent, index + 1);
+    moveValue(parent, index, left, left->size);
+    for (size_t i = 0; i < right->size; i++)
+    {
+      moveValue(right, i, left, left->size + 1 + i);
+    }
+    if (!left->isLeaf)
+    {
+      for (size_t i = 0; i <= right->size; i++)
+      {
+        Node *child = detail::getChild(right, i);
+        detail::getChild(left, left->size + 1 + i) = child;
+        child->parent = left;
+      }
+    }
+    left->size += right->size + 1;
+    for (size_t i = index + 1; i < parent->size; i++)
+    {
+      moveValue(parent, i, parent, i - 1);
+      detail::getChild(parent, i) = detail::getChild(parent, i + 1);
+    }
+    parent->size--;
+    right->size = 0;
+    freeNode(right);
+  }
+}
+
+#endif
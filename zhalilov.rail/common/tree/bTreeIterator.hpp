@@ -0,0 +1,169 @@
+#ifndef BTREEITERATOR_HPP
+#define BTREEITERATOR_HPP
+
+#include <iterator>
+
+#include "bTreeNode.hpp"
+
+namespace zhalilov
+{
+  template < class Key, class T, class Compare, size_t Degree >
+  class BTree;
+
+  template < class T, size_t Degree >
+  class BTreeIterator: public std::iterator < std::bidirectional_iterator_tag, T >
+  {
+  public:
+    using Node = detail::BTreeNode < T, Degree >;
+
+    ~BTreeIterator() = default;
+
+    BTreeIterator &operator=(const BTreeIterator &) = default;
+
+    BTreeIterator &operator++();
+    BTreeIterator &operator--();
+    BTreeIterator operator++(int);
+    BTreeIterator operator--(int);
+
+    T &operator*() const;
+    T *operator->() const;
+
+    bool operator==(BTreeIterator) const;
+    bool operator!=(BTreeIterator) const;
+
+    template < class Key, class Value, class Compare, size_t D >
+    friend class BTree;
+
+  private:
+    Node *node_;
+    size_t index_;
+
+    BTreeIterator(Node *node, size_t index);
+    static BTreeIterator findDeepestLeft(Node *);
+    static BTreeIterator findDeepestRight(Node *);
+    static BTreeIterator next(Node *, size_t);
+    static BTreeIterator prev(Node *, size_t);
+  };
+
+  template < class T, size_t Degree >
+  BTreeIterator < T, Degree > &BTreeIterator < T, Degree >::operator++()
+  {
+    *this = next(node_, index_);
+    return *this;
+  }
+
+  template < class T, size_t Degree >
+  BTreeIterator < T, Degree > &BTreeIterator < T, Degree >::operator--()
+  {
+    *this = prev(node_, index_);
+    return *this;
+  }
+
+  template < class T, size_t Degree >
+  BTreeIterator < T, Degree > BTreeIterator < T, Degree >::operator++(int)
+  {
+    BTreeIterator temp(*this);
+    operator++();
+    return temp;
+  }
+
+  template < class T, size_t Degree >
+  BTreeIterator < T, Degree > BTreeIterator < T, Degree >::operator--(int)
+  {
+    BTreeIterator temp(*this);
+    operator--();
+    return temp;
+  }
+
+  template < class T, size_t Degree >
+  T &BTreeIterator < T, Degree >::operator*() const
+  {
+    return detail::getValue(node_, index_);
+  }
+
+  template < class T, size_t Degree >
+  T *BTreeIterator < T, Degree >::operator->() const
+  {
+    return &detail::getValue(node_, index_);
+  }
+
+  template < class T, size_t Degree >
+  bool BTreeIterator < T, Degree >::operator==(BTreeIterator ait) const
+  {
+    return ait.node_ == node_ && ait.index_ == index_;
+  }
+
+  template < class T, size_t Degree >
+  bool BTreeIterator < T, Degree >::operator!=(BTreeIterator ait) const
+  {
+    return !operator==(ait);
+  }
+
+  template < class T, size_t Degree >
+  BTreeIterator < T, Degree >::BTreeIterator(Node *node, size_t index):
+    node_(node),
+    index_(index)
+  {}
+
+  template < class T, size_t Degree >
+  BTreeIterator < T, Degree > BTreeIterator < T, Degree >::findDeepestLeft(Node *nodeFrom)
+  {
+    while (!nodeFrom->isLeaf && detail::getChild(nodeFrom, 0))
+    {
+      nodeFrom = detail::getChild(nodeFrom, 0);
+    }
+    return BTreeIterator(nodeFrom, 0);
+  }
+
+  template < class T, size_t Degree >
+  BTreeIterator < T, Degree > BTreeIterator < T, Degree >::findDeepestRight(Node *nodeFrom)
+  {
+    while (!nodeFrom->isLeaf)
+    {
+      nodeFrom = detail::getChild(nodeFrom, nodeFrom->size);
+    }
+    return BTreeIterator(nodeFrom, nodeFrom->size - 1);
+  }
+
+  template < class T, size_t Degree >
+  BTreeIterator < T, Degree > BTreeIterator < T, Degree >::next(Node *node, size_t index)
+  {
+    if (!node->isLeaf)
+    {
+      return findDeepestLeft(detail::getChild(node, index + 1));
+    }
+    if (index + 1 < node->size)
+    {
+      return BTreeIterator(node, index + 1);
+    }
+    do
+    {
+      index = detail::getIndexInParent(node);
+      node = node->parent;
+    }
+    while (index == node->size && node->parent);
+    return BTreeIterator(node, index);
+  }
+
+  template < class T, size_t Degree >
+  BTreeIterator < T, Degree > BTreeIterator < T, Degree >::prev(Node *node, size_t index)
+  {
+    if (!node->isLeaf)
+    {
+      return findDeepestRight(detail::getChild(node, index));
+    }
+    if (index > 0)
+    {
+      return BTreeIterator(node, index - 1);
+    }
+    do
+    {
+      index = detail::getIndexInParent(node);
+      node = node->parent;
+    }
+    while (index == 0 && node->parent);
+    return BTreeIterator(node, index - 1);
+  }
+}
+
+#endif
@@ -0,0 +1,83 @@
+#ifndef BTREENODE_HPP
+#define BTREENODE_HPP
+
+#include <cstddef>
+#include <type_traits>
+
+namespace zhalilov
+{
+  namespace detail
+  {
+    template < class T, size_t Degree >
+    struct BTreeNode
+    {
+      BTreeNode *parent;
+      size_t size;
+      bool isLeaf;
+    };
+
+    template < class T, size_t Degree >
+    struct BTreeHeader: BTreeNode< T, Degree >
+    {
+      BTreeNode< T, Degree > *root;
+
+      BTreeHeader():
+        BTreeNode< T, Degree >{ nullptr, 0, false },
+        root(nullptr)
+      {}
+    };
+
+    template < class T, size_t Degree >
+    struct BTreeLeaf: BTreeNode< T, Degree >
+    {
+      static constexpr size_t maxSize = 2 * Degree - 1;
+      typename std::aligned_storage< sizeof(T), alignof(T) >::type data[maxSize];
+
+      T &value(size_t i)
+      {
+        return *reinterpret_cast< T * >(&data[i]);
+      }
+    };
+
+    template < class T, size_t Degree >
+    struct BTreeInternal: BTreeLeaf< T, Degree >
+    {
+      BTreeNode< T, Degree > *children[2 * Degree];
+    };
+
+    template < class T, size_t Degree >
+    T &getValue(BTreeNode< T, Degree > *node, size_t i)
+    {
+      return static_cast< BTreeLeaf< T, Degree > * >(node)->value(i);
+    }
+
+    template < class T, size_t Degree >
+    void *getSlot(BTreeNode< T, Degree > *node, size_t i)
+    {
+      return &static_cast< BTreeLeaf< T, Degree > * >(node)->data[i];
+    }
+
+    template < class T, size_t Degree >
+    BTreeNode< T, Degree > *&getChild(BTreeNode< T, Degree > *node, size_t i)
+    {
+      if (!node->parent)
+      {
+        return static_cast< BTreeHeader< T, Degree > * >(node)->root;
+      }
+      return static_cast< BTreeInternal< T, Degree > * >(node)->children[i];
+    }
+
+    template < class T, size_t Degree >
+    size_t getIndexInParent(BTreeNode< T, Degree > *node)
+    {
+      size_t i = 0;
+      while (getChild(node->parent, i) != node)
+      {
+        i++;
+      }
+      return i;
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,97 @@
+#ifndef CONST_BTREEITERATOR_HPP
+#define CONST_BTREEITERATOR_HPP
+
+#include <iterator>
+
+#include "bTreeIterator.hpp"
+
+namespace zhalilov
+{
+  template < class T, size_t Degree >
+  class ConstBTreeIterator: public std::iterator < std::bidirectional_iterator_tag, const T >
+  {
+  public:
+    ConstBTreeIterator(BTreeIterator < T, Degree >);
+    ~ConstBTreeIterator() = default;
+
+    ConstBTreeIterator &operator=(const ConstBTreeIterator &) = default;
+
+    ConstBTreeIterator &operator++();
+    ConstBTreeIterator &operator--();
+    ConstBTreeIterator operator++(int);
+    ConstBTreeIterator operator--(int);
+
+    const T &operator*() const;
+    const T *operator->() const;
+
+    bool operator==(ConstBTreeIterator) const;
+    bool operator!=(ConstBTreeIterator) const;
+
+    template < class Key, class Value, class Compare, size_t D >
+    friend class BTree;
+
+  private:
+    BTreeIterator < T, Degree > it_;
+  };
+
+  template < class T, size_t Degree >
+  ConstBTreeIterator < T, Degree >::ConstBTreeIterator(BTreeIterator < T, Degree > it):
+    it_(it)
+  {}
+
+  template < class T, size_t Degree >
+  ConstBTreeIterator < T, Degree > &ConstBTreeIterator < T, Degree >::operator++()
+  {
+    ++it_;
+    return *this;
+  }
+
+  template < class T, size_t Degree >
+  ConstBTreeIterator < T, Degree > &ConstBTreeIterator < T, Degree >::operator--()
+  {
+    --it_;
+    return *this;
+  }
+
+  template < class T, size_t Degree >
+  ConstBTreeIterator < T, Degree > ConstBTreeIterator < T, Degree >::operator++(int)
+  {
+    ConstBTreeIterator temp(*this);
+    operator++();
+    return temp;
+  }
+
+  template < class T, size_t Degree >
+  ConstBTreeIterator < T, Degree > ConstBTreeIterator < T, Degree >::operator--(int)
+  {
+    ConstBTreeIterator temp(*this);
+    operator--();
+    return temp;
+  }
+
+  template < class T, size_t Degree >
+  const T &ConstBTreeIterator < T, Degree >::operator*() const
+  {
+    return *it_;
+  }
+
+  template < class T, size_t Degree >
+  const T *ConstBTreeIterator < T, Degree >::operator->() const
+  {
+    return it_.operator->();
+  }
+
+  template < class T, size_t Degree >
+  bool ConstBTreeIterator < T, Degree >::operator==(ConstBTreeIterator ait) const
+  {
+    return ait.it_ == it_;
+  }
+
+  template < class T, size_t Degree >
+  bool ConstBTreeIterator < T, Degree >::operator!=(ConstBTreeIterator ait) const
+  {
+    return !operator==(ait);
+  }
+}
+
+#endif